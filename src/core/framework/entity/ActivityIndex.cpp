@@ -0,0 +1,284 @@
+//
+//  ActivityIndex.cpp
+//  noctisgames-framework
+//
+
+#include "pch.h"
+
+#include "ActivityIndex.h"
+
+#include "NGRect.h"
+
+#include <algorithm>
+#include <math.h>
+
+struct CompareLefts
+{
+    const std::vector<float>& lefts;
+    
+    CompareLefts(const std::vector<float>& inLefts) : lefts(inLefts)
+    {
+        // Empty
+    }
+    
+    bool operator()(int a, int b) const
+    {
+        return lefts[a] < lefts[b];
+    }
+};
+
+static bool isRemoved(std::vector<int>& removedSlots, int slot, int& numRemovedBefore)
+{
+    std::vector<int>::iterator i = std::lower_bound(removedSlots.begin(), removedSlots.end(), slot);
+    numRemovedBefore = (int) (i - removedSlots.begin());
+    
+    return i != removedSlots.end() && *i == slot;
+}
+
+ActivityIndex::ActivityIndex() : m_fMaxWidth(0), m_fTime(0), m_iCount(0), m_iNumDormant(0)
+{
+    // Empty
+}
+
+void ActivityIndex::clear()
+{
+    // The clock keeps running, entities that are still dormant get counted again when rebuilt
+    m_entities.clear();
+    m_slots.clear();
+    m_lefts.clear();
+    m_rights.clear();
+    m_alwaysActiveSlots.clear();
+    m_activeSlots.clear();
+    m_awakeSlots.clear();
+    
+    m_fMaxWidth = 0;
+    m_iCount = 0;
+    m_iNumDormant = 0;
+}
+
+int ActivityIndex::getCount()
+{
+    return m_iCount;
+}
+
+void ActivityIndex::gather(float left, float right, float deltaTime)
+{
+    m_activeSlots.clear();
+    
+    // Everything past end starts right of the window, and nothing is wider than m_fMaxWidth
+    int end = (int) (std::upper_bound(m_lefts.begin(), m_lefts.end(), right) - m_lefts.begin());
+    float minLeft = left - m_fMaxWidth;
+    
+    for (int i = end - 1; i >= 0 && m_lefts[i] >= minLeft; --i)
+    {
+        if (m_rights[i] >= left)
+        {
+            m_activeSlots.push_back(m_slots[i]);
+        }
+    }
+    
+    m_activeSlots.insert(m_activeSlots.end(), m_alwaysActiveSlots.begin(), m_alwaysActiveSlots.end());
+    
+    // Updates run in the same order as they would over the whole vector
+    std::sort(m_activeSlots.begin(), m_activeSlots.end());
+    
+    // Both lists are ascending, so one pass finds who dropped out and who came back
+    int numAwake = (int) m_awakeSlots.size();
+    int numActive = (int) m_activeSlots.size();
+    int i = 0;
+    int j = 0;
+    while (i < numAwake || j < numActive)
+    {
+        if (j == numActive
+            || (i < numAwake && m_awakeSlots[i] < m_activeSlots[j]))
+        {
+            m_entities[m_awakeSlots[i]]->m_fActivityIndexDormantTime = m_fTime;
+            m_iNumDormant++;
+            
+            i++;
+            
+            continue;
+        }
+        
+        if (i < numAwake && m_awakeSlots[i] == m_activeSlots[j])
+        {
+            i++;
+        }
+        else if (m_entities[m_activeSlots[j]]->m_fActivityIndexDormantTime >= 0)
+        {
+            wake(m_entities[m_activeSlots[j]]);
+        }
+        
+        j++;
+    }
+    
+    m_awakeSlots.assign(m_activeSlots.begin(), m_activeSlots.end());
+    
+    m_fTime += deltaTime;
+}
+
+void ActivityIndex::wakeAll()
+{
+    if (m_iNumDormant == 0)
+    {
+        return;
+    }
+    
+    m_awakeSlots.clear();
+    
+    for (int i = 0; i < (int) m_entities.size(); ++i)
+    {
+        if (m_entities[i]->m_fActivityIndexDormantTime >= 0)
+        {
+            wake(m_entities[i]);
+        }
+        
+        m_awakeSlots.push_back(i);
+    }
+}
+
+std::vector<int>& ActivityIndex::getActiveSlots()
+{
+    return m_activeSlots;
+}
+
+void ActivityIndex::remove(std::vector<int>& slots)
+{
+    int numRemovedBefore;
+    
+    int count = 0;
+    for (int i = 0; i < (int) m_entities.size(); ++i)
+    {
+        if (!isRemoved(slots, i, numRemovedBefore))
+        {
+            m_entities[count++] = m_entities[i];
+        }
+    }
+    
+    m_entities.resize(count);
+    
+    count = 0;
+    for (int i = 0; i < (int) m_slots.size(); ++i)
+    {
+        if (!isRemoved(slots, m_slots[i], numRemovedBefore))
+        {
+            m_slots[count] = m_slots[i] - numRemovedBefore;
+            m_lefts[count] = m_lefts[i];
+            m_rights[count] = m_rights[i];
+            
+            count++;
+        }
+    }
+    
+    m_slots.resize(count);
+    m_lefts.resize(count);
+    m_rights.resize(count);
+    
+    count = 0;
+    for (int i = 0; i < (int) m_alwaysActiveSlots.size(); ++i)
+    {
+        if (!isRemoved(slots, m_alwaysActiveSlots[i], numRemovedBefore))
+        {
+            m_alwaysActiveSlots[count++] = m_alwaysActiveSlots[i] - numRemovedBefore;
+        }
+    }
+    
+    m_alwaysActiveSlots.resize(count);
+    
+    count = 0;
+    for (int i = 0; i < (int) m_awakeSlots.size(); ++i)
+    {
+        if (!isRemoved(slots, m_awakeSlots[i], numRemovedBefore))
+        {
+            m_awakeSlots[count++] = m_awakeSlots[i] - numRemovedBefore;
+        }
+    }
+    
+    m_awakeSlots.resize(count);
+    
+    m_iCount -= (int) slots.size();
+}
+
+#pragma mark private
+
+void ActivityIndex::insert(int slot, PhysicalEntity* entity, int alwaysActiveTypeTags)
+{
+    m_entities.push_back(entity);
+    m_iCount++;
+    
+    if (entity->m_fActivityIndexDormantTime >= 0)
+    {
+        m_iNumDormant++;
+    }
+    else
+    {
+        m_awakeSlots.push_back(slot);
+    }
+    
+    if (entity->getTypeTags() & alwaysActiveTypeTags)
+    {
+        m_alwaysActiveSlots.push_back(slot);
+        
+        return;
+    }
+    
+    NGRect& bounds = entity->getMainBounds();
+    
+    float halfWidth = entity->getWidth() / 2;
+    float x = entity->getPosition().getX();
+    
+    // Same horizontal footprint as TransformStore
+    float l = fminf(x - halfWidth, bounds.getLeft());
+    float r = fmaxf(x + halfWidth, bounds.getRight());
+    
+    if (bounds.getAngle() != 0)
+    {
+        float radius = sqrtf(bounds.getWidth() * bounds.getWidth() + bounds.getHeight() * bounds.getHeight()) / 2;
+        float centerX = bounds.getLeft() + bounds.getWidth() / 2;
+        
+        l = fminf(l, centerX - radius);
+        r = fmaxf(r, centerX + radius);
+    }
+    
+    m_slots.push_back(slot);
+    m_lefts.push_back(l);
+    m_rights.push_back(r);
+    
+    m_fMaxWidth = fmaxf(m_fMaxWidth, r - l);
+}
+
+void ActivityIndex::wake(PhysicalEntity* entity)
+{
+    entity->onWake(m_fTime - entity->m_fActivityIndexDormantTime);
+    entity->m_fActivityIndexDormantTime = -1;
+    
+    m_iNumDormant--;
+}
+
+void ActivityIndex::sort()
+{
+    int count = (int) m_slots.size();
+    
+    m_order.resize(count);
+    for (int i = 0; i < count; ++i)
+    {
+        m_order[i] = i;
+    }
+    
+    std::sort(m_order.begin(), m_order.end(), CompareLefts(m_lefts));
+    
+    std::vector<int> slots(count);
+    std::vector<float> lefts(count);
+    std::vector<float> rights(count);
+    
+    for (int i = 0; i < count; ++i)
+    {
+        slots[i] = m_slots[m_order[i]];
+        lefts[i] = m_lefts[m_order[i]];
+        rights[i] = m_rights[m_order[i]];
+    }
+    
+    m_slots.swap(slots);
+    m_lefts.swap(lefts);
+    m_rights.swap(rights);
+}
@@ -0,0 +1,76 @@
+//
+//  ActivityIndex.h
+//  noctisgames-framework
+//
+
+#ifndef __noctisgames__ActivityIndex__
+#define __noctisgames__ActivityIndex__
+
+#include "PhysicalEntity.h"
+
+#include <vector>
+
+// Slots of entities that hold still horizontally, sorted by the left edge of their footprint,
+// so the ones overlapping a horizontal window are found without touching the rest of the level.
+// Entities that drop out of the window are stamped with the index clock, and are handed the
+// simulation time they sat out through onWake when they come back.
+class ActivityIndex
+{
+public:
+    ActivityIndex();
+    
+    void clear();
+    
+    int getCount();
+    
+    template<typename T>
+    void rebuild(std::vector<T*>& items, int alwaysActiveTypeTags)
+    {
+        clear();
+        
+        for (int i = 0; i < (int) items.size(); ++i)
+        {
+            insert(i, items[i], alwaysActiveTypeTags);
+        }
+        
+        sort();
+    }
+    
+    // Fills the active slots with everything overlapping left to right plus the always active entities, in ascending order,
+    // then advances the clock by the deltaTime those slots are about to be updated with
+    void gather(float left, float right, float deltaTime);
+    
+    // Catches up every dormant entity, for when the whole vector is about to be updated without the index
+    void wakeAll();
+    
+    std::vector<int>& getActiveSlots();
+    
+    // Forgets the ascending slots and shifts the rest down, like compacting the indexed vector
+    void remove(std::vector<int>& slots);
+
+private:
+    std::vector<PhysicalEntity*> m_entities;
+    std::vector<int> m_slots;
+    std::vector<float> m_lefts;
+    std::vector<float> m_rights;
+    std::vector<int> m_alwaysActiveSlots;
+    std::vector<int> m_activeSlots;
+    std::vector<int> m_awakeSlots;
+    std::vector<int> m_order;
+    float m_fMaxWidth;
+    float m_fTime;
+    int m_iCount;
+    int m_iNumDormant;
+    
+    void insert(int slot, PhysicalEntity* entity, int alwaysActiveTypeTags);
+    
+    void wake(PhysicalEntity* entity);
+    
+    void sort();
+    
+    // Prevent copying
+    ActivityIndex(const ActivityIndex&);
+    ActivityIndex& operator=(const ActivityIndex&);
+};
+
+#endif /* defined(__noctisgames__ActivityIndex__) */
@@ -10,7 +10,19 @@
 
 #include "Entity.h"
 
-Entity::Entity() : m_fStateTime(0.0f), m_isRequestingDeletion(false), m_ID(getUniqueEntityID())
+#include "ArenaAllocator.h"
+
+void* Entity::operator new(size_t size)
+{
+    return ArenaAllocator::allocate(size);
+}
+
+void Entity::operator delete(void* p)
+{
+    ArenaAllocator::deallocate(p);
+}
+
+Entity::Entity() : m_fStateTime(0.0f), m_iCapabilityTags(0), m_isRequestingDeletion(false), m_ID(getUniqueEntityID()), m_iTypeTags(TYPE_TAGS_UNRESOLVED)
 {
     // Empty
 }
@@ -50,6 +62,17 @@ bool Entity::isRequestingDeletion()
     return m_isRequestingDeletion;
 }
 
+int Entity::getTypeTags()
+{
+    if (m_iTypeTags == TYPE_TAGS_UNRESOLVED)
+    {
+        // getRTTI is only meaningful once the most derived constructor has run
+        m_iTypeTags = getRTTI().getTypeTags() | m_iCapabilityTags;
+    }
+    
+    return m_iTypeTags;
+}
+
 int Entity::getUniqueEntityID()
 {
     static int entityID = 0;
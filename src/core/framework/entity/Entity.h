@@ -11,11 +11,20 @@
 
 #include "RTTI.h"
 
+#include <stddef.h>
+
+#define TYPE_TAGS_UNRESOLVED -1
+
 class Entity
 {
     RTTI_DECL;
     
 public:
+    // Drawn from the current ArenaAllocator, if any
+    static void* operator new(size_t size);
+    
+    static void operator delete(void* p);
+    
     Entity();
     
     virtual ~Entity();
@@ -32,14 +41,19 @@ public:
     
     bool isRequestingDeletion();
     
+    // RTTI type tags plus capability tags, lets hot loops filter with a single AND
+    int getTypeTags();
+    
 protected:
     float m_fStateTime;
+    int m_iCapabilityTags;
     bool m_isRequestingDeletion;
     
 private:
     static int getUniqueEntityID();
     
     int m_ID;
+    int m_iTypeTags;
 };
 
 #endif /* defined(__noctisgames__Entity__) */
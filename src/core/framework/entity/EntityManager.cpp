@@ -21,28 +21,79 @@ EntityManager* EntityManager::getInstance()
     return &instance;
 }
 
-Entity* EntityManager::getEntityFromID(int id)const
+Entity* EntityManager::getEntity(EntityHandle handle) const
 {
-    std::map<int, Entity*>::const_iterator ent = m_entityMap.find(id);
+    if (!isValid(handle))
+    {
+        return nullptr;
+    }
     
-    assert((ent != m_entityMap.end()) && "<EntityManager::getEntityFromID>: invalid ID");
+    return m_entities[m_slotIndices[handle.slot]];
+}
+
+bool EntityManager::isValid(EntityHandle handle) const
+{
+    return handle.slot >= 0
+    && handle.slot < (int) m_slotGenerations.size()
+    && m_slotGenerations[handle.slot] == handle.generation;
+}
+
+EntityHandle EntityManager::registerEntity(Entity* entity)
+{
+    int slot;
+    if (m_freeSlots.size() > 0)
+    {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else
+    {
+        slot = (int) m_slotGenerations.size();
+        m_slotIndices.push_back(0);
+        m_slotGenerations.push_back(0);
+    }
     
-    return ent->second;
+    m_slotIndices[slot] = (int) m_entities.size();
+    m_entities.push_back(entity);
+    m_entitySlots.push_back(slot);
+    
+    return EntityHandle(slot, m_slotGenerations[slot]);
 }
 
-void EntityManager::registerEntity(Entity* entity)
+void EntityManager::removeEntity(EntityHandle handle)
 {
-    m_entityMap.insert(std::make_pair(entity->getID(), entity));
+    assert(isValid(handle) && "<EntityManager::removeEntity>: invalid handle");
+    
+    // The last entity fills the hole, so the packed array never has gaps
+    int index = m_slotIndices[handle.slot];
+    int last = (int) m_entities.size() - 1;
+    
+    m_entities[index] = m_entities[last];
+    m_entitySlots[index] = m_entitySlots[last];
+    m_slotIndices[m_entitySlots[index]] = index;
+    
+    m_entities.pop_back();
+    m_entitySlots.pop_back();
+    
+    m_slotGenerations[handle.slot]++;
+    m_freeSlots.push_back(handle.slot);
 }
 
-void EntityManager::removeEntity(Entity* entity)
+std::vector<Entity*>& EntityManager::getEntities()
 {
-    m_entityMap.erase(m_entityMap.find(entity->getID()));
+    return m_entities;
 }
 
 void EntityManager::reset()
 {
-    m_entityMap.clear();
+    for (std::vector<int>::iterator i = m_entitySlots.begin(); i != m_entitySlots.end(); ++i)
+    {
+        m_slotGenerations[(*i)]++;
+        m_freeSlots.push_back((*i));
+    }
+    
+    m_entities.clear();
+    m_entitySlots.clear();
 }
 
 EntityManager::EntityManager()
@@ -9,25 +9,48 @@
 #ifndef __noctisgames__EntityManager__
 #define __noctisgames__EntityManager__
 
-#include <map>
+#include <vector>
 
 class Entity;
 
+// A slot in the manager plus the generation that slot was on when the entity was registered,
+// so a handle to a removed entity never resolves to whatever reuses its slot
+struct EntityHandle
+{
+    int slot;
+    int generation;
+    
+    EntityHandle(int inSlot = -1, int inGeneration = 0) : slot(inSlot), generation(inGeneration)
+    {
+        // Empty
+    }
+};
+
 class EntityManager
 {
 public:
     static EntityManager* getInstance();
     
-    Entity* getEntityFromID(int id)const;
+    // nullptr once the entity has been removed
+    Entity* getEntity(EntityHandle handle) const;
+    
+    bool isValid(EntityHandle handle) const;
+    
+    EntityHandle registerEntity(Entity* entity);
     
-    void registerEntity(Entity* entity);
+    void removeEntity(EntityHandle handle);
     
-    void removeEntity(Entity* entity);
+    // Every registered entity, packed together in no particular order
+    std::vector<Entity*>& getEntities();
     
     void reset();
     
 private:
-    std::map<int, Entity*> m_entityMap;
+    std::vector<Entity*> m_entities;
+    std::vector<int> m_entitySlots;
+    std::vector<int> m_slotIndices;
+    std::vector<int> m_slotGenerations;
+    std::vector<int> m_freeSlots;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
     EntityManager();
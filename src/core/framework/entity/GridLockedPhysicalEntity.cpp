@@ -11,9 +11,10 @@
 #include "GridLockedPhysicalEntity.h"
 
 #include "GridManager.h"
+#include "SpatialHash.h"
 #include "NGRect.h"
 
-GridLockedPhysicalEntity::GridLockedPhysicalEntity(int gridX, int gridY, int gridWidth, int gridHeight, float boundsX, float boundsY, float boundsWidth, float boundsHeight) : PhysicalEntity(gridX * GM_GRID_CELL_SIZE, gridY * GM_GRID_CELL_SIZE, gridWidth * GM_GRID_CELL_SIZE, gridHeight * GM_GRID_CELL_SIZE), m_iGridX(gridX), m_iGridY(gridY), m_iGridWidth(gridWidth), m_iGridHeight(gridHeight), m_fBoundsX(boundsX), m_fBoundsY(boundsY), m_fBoundsWidth(boundsWidth), m_fBoundsHeight(boundsHeight)
+GridLockedPhysicalEntity::GridLockedPhysicalEntity(int gridX, int gridY, int gridWidth, int gridHeight, float boundsX, float boundsY, float boundsWidth, float boundsHeight) : PhysicalEntity(gridX * GM_GRID_CELL_SIZE, gridY * GM_GRID_CELL_SIZE, gridWidth * GM_GRID_CELL_SIZE, gridHeight * GM_GRID_CELL_SIZE), m_iGridX(gridX), m_iGridY(gridY), m_iGridWidth(gridWidth), m_iGridHeight(gridHeight), m_fBoundsX(boundsX), m_fBoundsY(boundsY), m_fBoundsWidth(boundsWidth), m_fBoundsHeight(boundsHeight), m_spatialHash(nullptr), m_iSpatialHashLeft(0), m_iSpatialHashBottom(0), m_iSpatialHashRight(-1), m_iSpatialHashTop(-1), m_iSpatialHashSlot(-1), m_iSpatialHashQueryID(-1)
 {
     updateBounds();
     getMainBounds().getLowerLeft().set(gridX * GM_GRID_CELL_SIZE, gridY * GM_GRID_CELL_SIZE);
@@ -24,7 +25,7 @@ GridLockedPhysicalEntity::GridLockedPhysicalEntity(int gridX, int gridY, int gri
 
 GridLockedPhysicalEntity::~GridLockedPhysicalEntity()
 {
-    // Empty
+    removeFromSpatialHash();
 }
 
 void GridLockedPhysicalEntity::updateBounds()
@@ -37,6 +38,11 @@ void GridLockedPhysicalEntity::updateBounds()
 	getMainBounds().getLowerLeft().add(getWidth() * m_fBoundsX, getHeight() * m_fBoundsY);
 	getMainBounds().setWidth(getWidth() * m_fBoundsWidth);
 	getMainBounds().setHeight(getHeight() * m_fBoundsHeight);
+    
+    if (m_spatialHash)
+    {
+        m_spatialHash->update(this);
+    }
 }
 
 void GridLockedPhysicalEntity::snapToGrid(int gridCellSizeScalar)
@@ -77,6 +83,43 @@ void GridLockedPhysicalEntity::placeOn(float itemTopY)
 	updateBounds();
 }
 
+void GridLockedPhysicalEntity::resetToSnapshot(int gridX, int gridY)
+{
+    m_fWidth = m_iGridWidth * GM_GRID_CELL_SIZE;
+    m_fHeight = m_iGridHeight * GM_GRID_CELL_SIZE;
+    m_fAngle = 0;
+    m_fActivityIndexDormantTime = -1;
+    
+    restoreGridPosition(gridX, gridY);
+}
+
+void GridLockedPhysicalEntity::restoreGridPosition(int gridX, int gridY)
+{
+    m_iGridX = gridX;
+    m_iGridY = gridY;
+    
+    // Same steps as the constructor, so the bounds come out bit for bit the same
+    m_position.set(m_iGridX * GM_GRID_CELL_SIZE, m_iGridY * GM_GRID_CELL_SIZE);
+    GridLockedPhysicalEntity::updateBounds();
+    getMainBounds().getLowerLeft().set(m_iGridX * GM_GRID_CELL_SIZE, m_iGridY * GM_GRID_CELL_SIZE);
+    m_position.sub(getWidth() * m_fBoundsX, getHeight() * m_fBoundsY);
+    m_position.add(getWidth() / 2, getHeight() / 2);
+    
+    m_velocity.set(0, 0);
+    m_acceleration.set(0, 0);
+    
+    m_fStateTime = 0;
+    m_isRequestingDeletion = false;
+}
+
+void GridLockedPhysicalEntity::removeFromSpatialHash()
+{
+    if (m_spatialHash)
+    {
+        m_spatialHash->remove(this);
+    }
+}
+
 int GridLockedPhysicalEntity::getGridX()
 {
     return m_iGridX;
@@ -13,10 +13,14 @@
 
 #include "RTTI.h"
 
+class SpatialHash;
+
 class GridLockedPhysicalEntity : public PhysicalEntity
 {
     RTTI_DECL;
     
+    friend class SpatialHash;
+    
 public:
     GridLockedPhysicalEntity(int gridX, int gridY, int gridWidth, int gridHeight, float boundsX = 0, float boundsY = 0, float boundsWidth = 1, float boundsHeight = 1);
     
@@ -27,6 +31,13 @@ public:
 	virtual void placeOn(float itemTopY);
 		
 	virtual void snapToGrid(int gridCellSizeScalar = 1);
+    
+    // Puts the entity back the way its constructor left it, at the given grid position
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
+    void restoreGridPosition(int gridX, int gridY);
+    
+    void removeFromSpatialHash();
 
 	int getGridX();
     
@@ -41,6 +52,15 @@ protected:
     int m_iGridY;
     int m_iGridWidth;
     int m_iGridHeight;
+    
+private:
+    SpatialHash* m_spatialHash;
+    int m_iSpatialHashLeft;
+    int m_iSpatialHashBottom;
+    int m_iSpatialHashRight;
+    int m_iSpatialHashTop;
+    int m_iSpatialHashSlot;
+    int m_iSpatialHashQueryID;
 };
 
 #endif /* defined(__noctisgames__GridLockedPhysicalEntity__) */
@@ -20,7 +20,8 @@ m_velocity(),
 m_acceleration(),
 m_fWidth(width),
 m_fHeight(height),
-m_fAngle(0)
+m_fAngle(0),
+m_fActivityIndexDormantTime(-1)
 {
     m_bounds.push_back(new NGRect(x - width / 2, y - height / 2, width, height));
 }
@@ -61,6 +62,11 @@ void PhysicalEntity::placeOn(float itemTopY)
 	updateBounds();
 }
 
+void PhysicalEntity::onWake(float elapsed)
+{
+    // Override in Subclass
+}
+
 Vector2D& PhysicalEntity::getPosition()
 {
     return m_position;
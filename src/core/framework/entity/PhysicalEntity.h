@@ -23,6 +23,8 @@ class PhysicalEntity : public Entity
 {
     RTTI_DECL;
     
+    friend class ActivityIndex;
+    
 public:
     PhysicalEntity(float x, float y, float width, float height);
     
@@ -35,6 +37,9 @@ public:
     virtual void updateBounds();
 
 	virtual void placeOn(float itemTopY);
+    
+    // Called by the activity index before the first update after sitting out elapsed seconds of simulation
+    virtual void onWake(float elapsed);
 
     Vector2D& getPosition();
     
@@ -66,6 +71,7 @@ protected:
     float m_fWidth;
     float m_fHeight;
     float m_fAngle;
+    float m_fActivityIndexDormantTime;
 };
 
 #endif /* defined(__noctisgames__PhysicalEntity__) */
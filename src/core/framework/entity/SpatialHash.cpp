@@ -0,0 +1,221 @@
+//
+//  SpatialHash.cpp
+//  noctisgames-framework
+//
+
+#include "pch.h"
+
+#include "SpatialHash.h"
+
+#include "GridManager.h"
+#include "NGRect.h"
+
+#include <algorithm>
+#include <math.h>
+
+SpatialHash::SpatialHash(int numGridCellsPerBucket) : m_iNumGridCellsPerBucket(numGridCellsPerBucket), m_iCount(0), m_iQueryID(0)
+{
+    // Empty
+}
+
+SpatialHash::~SpatialHash()
+{
+    clear();
+}
+
+void SpatialHash::insert(GridLockedPhysicalEntity* entity, int slot)
+{
+    if (entity->m_spatialHash == this)
+    {
+        return;
+    }
+    
+    if (entity->m_spatialHash)
+    {
+        entity->m_spatialHash->remove(entity);
+    }
+    
+    entity->m_spatialHash = this;
+    entity->m_iSpatialHashSlot = slot;
+    entity->m_iSpatialHashQueryID = -1;
+    
+    calcBucketRange(entity, entity->m_iSpatialHashLeft, entity->m_iSpatialHashBottom, entity->m_iSpatialHashRight, entity->m_iSpatialHashTop);
+    
+    addToBuckets(entity);
+    
+    m_iCount++;
+}
+
+void SpatialHash::remove(GridLockedPhysicalEntity* entity)
+{
+    if (entity->m_spatialHash != this)
+    {
+        return;
+    }
+    
+    removeFromBuckets(entity);
+    
+    entity->m_spatialHash = nullptr;
+    
+    m_iCount--;
+}
+
+void SpatialHash::update(GridLockedPhysicalEntity* entity)
+{
+    int left, bottom, right, top;
+    calcBucketRange(entity, left, bottom, right, top);
+    
+    if (left == entity->m_iSpatialHashLeft
+        && bottom == entity->m_iSpatialHashBottom
+        && right == entity->m_iSpatialHashRight
+        && top == entity->m_iSpatialHashTop)
+    {
+        return;
+    }
+    
+    removeFromBuckets(entity);
+    
+    entity->m_iSpatialHashLeft = left;
+    entity->m_iSpatialHashBottom = bottom;
+    entity->m_iSpatialHashRight = right;
+    entity->m_iSpatialHashTop = top;
+    
+    addToBuckets(entity);
+}
+
+void SpatialHash::clear()
+{
+    for (std::unordered_map<long long, std::vector<GridLockedPhysicalEntity*> >::iterator i = m_buckets.begin(); i != m_buckets.end(); ++i)
+    {
+        for (std::vector<GridLockedPhysicalEntity*>::iterator j = i->second.begin(); j != i->second.end(); ++j)
+        {
+            (*j)->m_spatialHash = nullptr;
+        }
+    }
+    
+    m_buckets.clear();
+    m_gathered.clear();
+    
+    m_iCount = 0;
+}
+
+int SpatialHash::getCount()
+{
+    return m_iCount;
+}
+
+#pragma mark private
+
+void SpatialHash::gather(NGRect& region)
+{
+    m_gathered.clear();
+    
+    if (m_iCount == 0)
+    {
+        return;
+    }
+    
+    m_iQueryID++;
+    
+    float bucketSize = getBucketSize();
+    int left = (int) floorf(region.getLeft() / bucketSize);
+    int bottom = (int) floorf(region.getBottom() / bucketSize);
+    int right = (int) floorf(region.getRight() / bucketSize);
+    int top = (int) floorf(region.getTop() / bucketSize);
+    
+    for (int x = left; x <= right; ++x)
+    {
+        for (int y = bottom; y <= top; ++y)
+        {
+            std::unordered_map<long long, std::vector<GridLockedPhysicalEntity*> >::iterator bucket = m_buckets.find(calcKey(x, y));
+            if (bucket == m_buckets.end())
+            {
+                continue;
+            }
+            
+            for (std::vector<GridLockedPhysicalEntity*>::iterator i = bucket->second.begin(); i != bucket->second.end(); ++i)
+            {
+                if ((*i)->m_iSpatialHashQueryID != m_iQueryID)
+                {
+                    (*i)->m_iSpatialHashQueryID = m_iQueryID;
+                    m_gathered.push_back((*i));
+                }
+            }
+        }
+    }
+    
+    // Slots were taken at rebuild, erasing from the vector since then keeps the survivors in the same relative order
+    std::sort(m_gathered.begin(), m_gathered.end(), SpatialHash::compareSlots);
+}
+
+void SpatialHash::calcBucketRange(GridLockedPhysicalEntity* entity, int& left, int& bottom, int& right, int& top)
+{
+    NGRect& bounds = entity->getMainBounds();
+    
+    float halfWidth = entity->getWidth() / 2;
+    float halfHeight = entity->getHeight() / 2;
+    float x = entity->getPosition().getX();
+    float y = entity->getPosition().getY();
+    
+    // Footprint is the union of the sprite rect and the main bounds, which covers any secondary bounds as well
+    float l = fminf(x - halfWidth, bounds.getLeft());
+    float b = fminf(y - halfHeight, bounds.getBottom());
+    float r = fmaxf(x + halfWidth, bounds.getRight());
+    float t = fmaxf(y + halfHeight, bounds.getTop());
+    
+    float bucketSize = getBucketSize();
+    left = (int) floorf(l / bucketSize);
+    bottom = (int) floorf(b / bucketSize);
+    right = (int) floorf(r / bucketSize);
+    top = (int) floorf(t / bucketSize);
+}
+
+void SpatialHash::addToBuckets(GridLockedPhysicalEntity* entity)
+{
+    for (int x = entity->m_iSpatialHashLeft; x <= entity->m_iSpatialHashRight; ++x)
+    {
+        for (int y = entity->m_iSpatialHashBottom; y <= entity->m_iSpatialHashTop; ++y)
+        {
+            m_buckets[calcKey(x, y)].push_back(entity);
+        }
+    }
+}
+
+void SpatialHash::removeFromBuckets(GridLockedPhysicalEntity* entity)
+{
+    for (int x = entity->m_iSpatialHashLeft; x <= entity->m_iSpatialHashRight; ++x)
+    {
+        for (int y = entity->m_iSpatialHashBottom; y <= entity->m_iSpatialHashTop; ++y)
+        {
+            std::unordered_map<long long, std::vector<GridLockedPhysicalEntity*> >::iterator bucket = m_buckets.find(calcKey(x, y));
+            if (bucket == m_buckets.end())
+            {
+                continue;
+            }
+            
+            std::vector<GridLockedPhysicalEntity*>& items = bucket->second;
+            std::vector<GridLockedPhysicalEntity*>::iterator i = std::find(items.begin(), items.end(), entity);
+            if (i != items.end())
+            {
+                // Bucket order does not matter, results are sorted on the way out
+                *i = items.back();
+                items.pop_back();
+            }
+        }
+    }
+}
+
+float SpatialHash::getBucketSize()
+{
+    return GM_GRID_CELL_SIZE * m_iNumGridCellsPerBucket;
+}
+
+bool SpatialHash::compareSlots(GridLockedPhysicalEntity* a, GridLockedPhysicalEntity* b)
+{
+    return a->m_iSpatialHashSlot < b->m_iSpatialHashSlot;
+}
+
+long long SpatialHash::calcKey(int bucketX, int bucketY)
+{
+    return (long long) ((((unsigned long long) (unsigned int) bucketX) << 32) | ((unsigned int) bucketY));
+}
@@ -0,0 +1,86 @@
+//
+//  SpatialHash.h
+//  noctisgames-framework
+//
+
+#ifndef __noctisgames__SpatialHash__
+#define __noctisgames__SpatialHash__
+
+#include "GridLockedPhysicalEntity.h"
+
+#include <vector>
+#include <unordered_map>
+
+class NGRect;
+
+class SpatialHash
+{
+public:
+    SpatialHash(int numGridCellsPerBucket = 32);
+    
+    ~SpatialHash();
+    
+    // Slot is where the entity sits in its vector, query results come back in ascending slot order
+    void insert(GridLockedPhysicalEntity* entity, int slot);
+    
+    void remove(GridLockedPhysicalEntity* entity);
+    
+    void update(GridLockedPhysicalEntity* entity);
+    
+    void clear();
+    
+    int getCount();
+    
+    template<typename T>
+    void rebuild(std::vector<T*>& items)
+    {
+        clear();
+        
+        for (int i = 0; i < (int) items.size(); ++i)
+        {
+            insert(items[i], i);
+        }
+    }
+    
+    template<typename T>
+    std::vector<T*>& query(NGRect& region, std::vector<T*>& results)
+    {
+        results.clear();
+        
+        gather(region);
+        
+        for (std::vector<GridLockedPhysicalEntity*>::iterator i = m_gathered.begin(); i != m_gathered.end(); ++i)
+        {
+            results.push_back(static_cast<T*>((*i)));
+        }
+        
+        return results;
+    }
+
+private:
+    std::unordered_map<long long, std::vector<GridLockedPhysicalEntity*> > m_buckets;
+    std::vector<GridLockedPhysicalEntity*> m_gathered;
+    int m_iNumGridCellsPerBucket;
+    int m_iCount;
+    int m_iQueryID;
+    
+    void gather(NGRect& region);
+    
+    void calcBucketRange(GridLockedPhysicalEntity* entity, int& left, int& bottom, int& right, int& top);
+    
+    void addToBuckets(GridLockedPhysicalEntity* entity);
+    
+    void removeFromBuckets(GridLockedPhysicalEntity* entity);
+    
+    float getBucketSize();
+    
+    static bool compareSlots(GridLockedPhysicalEntity* a, GridLockedPhysicalEntity* b);
+    
+    static long long calcKey(int bucketX, int bucketY);
+    
+    // Prevent copying
+    SpatialHash(const SpatialHash&);
+    SpatialHash& operator=(const SpatialHash&);
+};
+
+#endif /* defined(__noctisgames__SpatialHash__) */
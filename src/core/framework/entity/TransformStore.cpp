@@ -0,0 +1,102 @@
+//
+//  TransformStore.cpp
+//  noctisgames-framework
+//
+
+#include "pch.h"
+
+#include "TransformStore.h"
+
+#include "NGRect.h"
+#include "OverlapTester.h"
+
+#include <math.h>
+
+TransformStore::TransformStore() : m_iCount(0)
+{
+    // Empty
+}
+
+void TransformStore::clear()
+{
+    resize(0);
+    
+    m_gathered.clear();
+}
+
+int TransformStore::getCount()
+{
+    return m_iCount;
+}
+
+#pragma mark private
+
+void TransformStore::resize(int count)
+{
+    m_entities.resize(count);
+    m_lefts.resize(count);
+    m_bottoms.resize(count);
+    m_rights.resize(count);
+    m_tops.resize(count);
+    m_hits.resize(count);
+    
+    m_iCount = count;
+}
+
+void TransformStore::write(int slot, PhysicalEntity* entity)
+{
+    NGRect& bounds = entity->getMainBounds();
+    
+    float halfWidth = entity->getWidth() / 2;
+    float halfHeight = entity->getHeight() / 2;
+    float x = entity->getPosition().getX();
+    float y = entity->getPosition().getY();
+    
+    // Same footprint as SpatialHash, the union of the sprite rect and the main bounds
+    float l = fminf(x - halfWidth, bounds.getLeft());
+    float b = fminf(y - halfHeight, bounds.getBottom());
+    float r = fmaxf(x + halfWidth, bounds.getRight());
+    float t = fmaxf(y + halfHeight, bounds.getTop());
+    
+    if (bounds.getAngle() != 0)
+    {
+        // Any rotation of the bounds stays within the circle around its center
+        float radius = sqrtf(bounds.getWidth() * bounds.getWidth() + bounds.getHeight() * bounds.getHeight()) / 2;
+        float centerX = bounds.getLeft() + bounds.getWidth() / 2;
+        float centerY = bounds.getBottom() + bounds.getHeight() / 2;
+        
+        l = fminf(l, centerX - radius);
+        b = fminf(b, centerY - radius);
+        r = fmaxf(r, centerX + radius);
+        t = fmaxf(t, centerY + radius);
+    }
+    
+    m_entities[slot] = entity;
+    m_lefts[slot] = l;
+    m_bottoms[slot] = b;
+    m_rights[slot] = r;
+    m_tops[slot] = t;
+}
+
+void TransformStore::gather(NGRect& region)
+{
+    m_gathered.clear();
+    
+    float left = region.getLeft();
+    float bottom = region.getBottom();
+    float right = region.getRight();
+    float top = region.getTop();
+    
+    if (OverlapTester::calcAABBOverlapMask(left, bottom, right, top, m_lefts.data(), m_bottoms.data(), m_rights.data(), m_tops.data(), m_iCount, m_hits.data()) == 0)
+    {
+        return;
+    }
+    
+    for (int i = 0; i < m_iCount; ++i)
+    {
+        if (m_hits[i])
+        {
+            m_gathered.push_back(i);
+        }
+    }
+}
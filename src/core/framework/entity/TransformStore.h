@@ -0,0 +1,74 @@
+//
+//  TransformStore.h
+//  noctisgames-framework
+//
+
+#ifndef __noctisgames__TransformStore__
+#define __noctisgames__TransformStore__
+
+#include "PhysicalEntity.h"
+
+#include <vector>
+
+class NGRect;
+
+// Structure of arrays copy of the footprints of moving entities, slot i always holds items[i].
+// It is only a mirror rebuilt by sync() once the entities have moved, PhysicalEntity still owns
+// its position, velocity, and bounds, so nothing written here ever reaches the entity.
+class TransformStore
+{
+public:
+    TransformStore();
+    
+    void clear();
+    
+    int getCount();
+    
+    template<typename T>
+    void sync(std::vector<T*>& items)
+    {
+        resize((int) items.size());
+        
+        for (int i = 0; i < m_iCount; ++i)
+        {
+            write(i, items[i]);
+        }
+    }
+    
+    template<typename T>
+    std::vector<T*>& query(NGRect& region, std::vector<T*>& results)
+    {
+        results.clear();
+        
+        gather(region);
+        
+        for (std::vector<int>::iterator i = m_gathered.begin(); i != m_gathered.end(); ++i)
+        {
+            results.push_back(static_cast<T*>(m_entities[(*i)]));
+        }
+        
+        return results;
+    }
+
+private:
+    std::vector<PhysicalEntity*> m_entities;
+    std::vector<float> m_lefts;
+    std::vector<float> m_bottoms;
+    std::vector<float> m_rights;
+    std::vector<float> m_tops;
+    std::vector<unsigned char> m_hits;
+    std::vector<int> m_gathered;
+    int m_iCount;
+    
+    void resize(int count);
+    
+    void write(int slot, PhysicalEntity* entity);
+    
+    void gather(NGRect& region);
+    
+    // Prevent copying
+    TransformStore(const TransformStore&);
+    TransformStore& operator=(const TransformStore&);
+};
+
+#endif /* defined(__noctisgames__TransformStore__) */
@@ -0,0 +1,135 @@
+//
+//  LinuxAssetDataHandler.cpp
+//  noctisgames-framework
+//
+
+#include "pch.h"
+
+#include "LinuxAssetDataHandler.h"
+
+#include "PackedAssetArchive.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+LinuxAssetDataHandler* LinuxAssetDataHandler::getInstance()
+{
+    // The texture loading threads can get here first, a function local static is initialized exactly once
+    static LinuxAssetDataHandler instance;
+    return &instance;
+}
+
+FileData LinuxAssetDataHandler::getAssetData(const char* relativePath)
+{
+    assert(relativePath != NULL);
+    
+    if (m_archive
+        && m_archive->contains(relativePath))
+    {
+        return m_archive->getAssetData(relativePath);
+    }
+    
+    FILE* stream = fopen(relativePath, "rb");
+    assert(stream != NULL);
+    
+    fseek(stream, 0, SEEK_END);
+    long stream_size = ftell(stream);
+    fseek(stream, 0, SEEK_SET);
+    
+    void* buffer = malloc(stream_size);
+    fread(buffer, stream_size, 1, stream);
+    
+    assert(ferror(stream) == 0);
+    fclose(stream);
+    
+    return (FileData)
+    {
+        stream_size, buffer, NULL
+    };
+}
+
+void LinuxAssetDataHandler::releaseAssetData(const FileData* fileData)
+{
+    assert(fileData != NULL);
+    assert(fileData->data != NULL);
+    
+    if (m_archive != nullptr
+        && fileData->file_handle == m_archive)
+    {
+        // A span of the mapping, nothing to free
+        return;
+    }
+    
+    free((void *)fileData->data);
+}
+
+bool LinuxAssetDataHandler::hasArchive()
+{
+    return m_archive != nullptr;
+}
+
+#pragma mark private
+
+void LinuxAssetDataHandler::mapArchive(const char* archivePath)
+{
+    int fd = open(archivePath, O_RDONLY);
+    if (fd < 0)
+    {
+        return;
+    }
+    
+    struct stat st;
+    if (fstat(fd, &st) != 0
+        || st.st_size <= 0)
+    {
+        close(fd);
+        
+        return;
+    }
+    
+    void* data = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    
+    // The mapping keeps the file alive
+    close(fd);
+    
+    if (data == MAP_FAILED)
+    {
+        return;
+    }
+    
+    PackedAssetArchive* archive = new PackedAssetArchive(data, (size_t) st.st_size);
+    if (!archive->isValid())
+    {
+        delete archive;
+        munmap(data, (size_t) st.st_size);
+        
+        return;
+    }
+    
+    m_archiveData = data;
+    m_archiveSize = (size_t) st.st_size;
+    m_archive = archive;
+}
+
+LinuxAssetDataHandler::LinuxAssetDataHandler() : AssetDataHandler(),
+m_archiveData(nullptr),
+m_archiveSize(0),
+m_archive(nullptr)
+{
+    mapArchive(ASSET_ARCHIVE_FILE_NAME);
+}
+
+LinuxAssetDataHandler::~LinuxAssetDataHandler()
+{
+    delete m_archive;
+    
+    if (m_archiveData)
+    {
+        munmap(m_archiveData, m_archiveSize);
+    }
+}
@@ -0,0 +1,44 @@
+//
+//  LinuxAssetDataHandler.h
+//  noctisgames-framework
+//
+
+#ifndef __noctisgames__LinuxAssetDataHandler__
+#define __noctisgames__LinuxAssetDataHandler__
+
+#include "AssetDataHandler.h"
+
+#include <stddef.h>
+
+// Built by tools/NGPackAssets, looked up in the working directory
+#define ASSET_ARCHIVE_FILE_NAME "assets.ngpak"
+
+class PackedAssetArchive;
+
+class LinuxAssetDataHandler : public AssetDataHandler
+{
+public:
+    static LinuxAssetDataHandler* getInstance();
+    
+    // Served from the mapped archive without copying when it has the asset, read from a loose file otherwise
+    virtual FileData getAssetData(const char* relativePath);
+    
+    virtual void releaseAssetData(const FileData* fileData);
+    
+    bool hasArchive();
+
+private:
+    void* m_archiveData;
+    size_t m_archiveSize;
+    PackedAssetArchive* m_archive;
+    
+    void mapArchive(const char* archivePath);
+    
+    // ctor, copy ctor, and assignment should be private in a Singleton
+    LinuxAssetDataHandler();
+    ~LinuxAssetDataHandler();
+    LinuxAssetDataHandler(const LinuxAssetDataHandler&);
+    LinuxAssetDataHandler& operator=(const LinuxAssetDataHandler&);
+};
+
+#endif /* defined(__noctisgames__LinuxAssetDataHandler__) */
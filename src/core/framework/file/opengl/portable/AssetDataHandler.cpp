@@ -12,6 +12,8 @@
 #include "AppleAssetDataHandler.h"
 #elif defined __ANDROID__
 #include "AndroidAssetDataHandler.h"
+#elif defined __linux__
+#include "LinuxAssetDataHandler.h"
 #endif
 
 #include <assert.h>
@@ -22,6 +24,8 @@ AssetDataHandler* AssetDataHandler::getAssetDataHandler()
     return AppleAssetDataHandler::getInstance();
 #elif defined __ANDROID__
     return AndroidAssetDataHandler::getInstance();
+#elif defined __linux__
+    return LinuxAssetDataHandler::getInstance();
 #endif
     
     assert(false);
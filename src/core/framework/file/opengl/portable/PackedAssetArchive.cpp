@@ -0,0 +1,104 @@
+//
+//  PackedAssetArchive.cpp
+//  noctisgames-framework
+//
+
+#include "pch.h"
+
+#include "PackedAssetArchive.h"
+
+#include <assert.h>
+
+PackedAssetArchive::PackedAssetArchive(const void* data, size_t size) :
+m_data((const unsigned char*) data),
+m_size(size),
+m_entries(nullptr),
+m_iNumEntries(0),
+m_isValid(false)
+{
+    if (m_data == nullptr
+        || m_size < sizeof(PackedAssetHeader))
+    {
+        return;
+    }
+    
+    const PackedAssetHeader* header = (const PackedAssetHeader*) m_data;
+    if (memcmp(header->magic, PACKED_ASSET_MAGIC, 4) != 0
+        || header->version != PACKED_ASSET_VERSION
+        || header->numEntries > (m_size - sizeof(PackedAssetHeader)) / sizeof(PackedAssetEntry))
+    {
+        return;
+    }
+    
+    const PackedAssetEntry* entries = (const PackedAssetEntry*) (m_data + sizeof(PackedAssetHeader));
+    for (uint32_t i = 0; i < header->numEntries; ++i)
+    {
+        if (entries[i].offset > m_size
+            || entries[i].size > m_size - entries[i].offset
+            || (i > 0 && entries[i - 1].nameHash >= entries[i].nameHash))
+        {
+            return;
+        }
+    }
+    
+    m_entries = entries;
+    m_iNumEntries = (int) header->numEntries;
+    m_isValid = true;
+}
+
+bool PackedAssetArchive::isValid()
+{
+    return m_isValid;
+}
+
+const PackedAssetEntry* PackedAssetArchive::findEntry(const char* name)
+{
+    assert(name != nullptr);
+    
+    uint64_t nameHash = packedAssetNameHash(name);
+    
+    // The table is sorted by hash and the packer refuses collisions
+    int low = 0;
+    int high = m_iNumEntries - 1;
+    while (low <= high)
+    {
+        int mid = low + (high - low) / 2;
+        uint64_t midHash = m_entries[mid].nameHash;
+        
+        if (midHash == nameHash)
+        {
+            return &m_entries[mid];
+        }
+        else if (midHash < nameHash)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid - 1;
+        }
+    }
+    
+    return nullptr;
+}
+
+bool PackedAssetArchive::contains(const char* name)
+{
+    return findEntry(name) != nullptr;
+}
+
+FileData PackedAssetArchive::getAssetData(const char* name)
+{
+    const PackedAssetEntry* entry = findEntry(name);
+    assert(entry != nullptr);
+    
+    return (FileData)
+    {
+        (long) entry->size, m_data + entry->offset, this
+    };
+}
+
+int PackedAssetArchive::getNumEntries()
+{
+    return m_iNumEntries;
+}
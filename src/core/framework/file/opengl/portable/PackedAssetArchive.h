@@ -0,0 +1,46 @@
+//
+//  PackedAssetArchive.h
+//  noctisgames-framework
+//
+
+#ifndef __noctisgames__PackedAssetArchive__
+#define __noctisgames__PackedAssetArchive__
+
+#include "PackedAssetFormat.h"
+#include "FileData.h"
+
+#include <stddef.h>
+
+// Reads an archive built by tools/NGPackAssets out of memory the caller owns, typically a mapping of the whole file.
+// Lookups never copy, the FileData handed out points straight into that memory.
+class PackedAssetArchive
+{
+public:
+    PackedAssetArchive(const void* data, size_t size);
+    
+    // False if the data is not a well formed archive
+    bool isValid();
+    
+    // nullptr if there is no asset by that name
+    const PackedAssetEntry* findEntry(const char* name);
+    
+    bool contains(const char* name);
+    
+    // file_handle is set to this archive, so callers can tell archive spans from loose files
+    FileData getAssetData(const char* name);
+    
+    int getNumEntries();
+
+private:
+    const unsigned char* m_data;
+    size_t m_size;
+    const PackedAssetEntry* m_entries;
+    int m_iNumEntries;
+    bool m_isValid;
+    
+    // Prevent copying
+    PackedAssetArchive(const PackedAssetArchive&);
+    PackedAssetArchive& operator=(const PackedAssetArchive&);
+};
+
+#endif /* defined(__noctisgames__PackedAssetArchive__) */
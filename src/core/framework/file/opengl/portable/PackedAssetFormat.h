@@ -0,0 +1,57 @@
+//
+//  PackedAssetFormat.h
+//  noctisgames-framework
+//
+
+#ifndef __noctisgames__PackedAssetFormat__
+#define __noctisgames__PackedAssetFormat__
+
+// Shared by the runtime reader and tools/NGPackAssets.c, so this header stays plain C
+
+#include <stdint.h>
+#include <string.h>
+
+#define PACKED_ASSET_MAGIC "NGPK"
+#define PACKED_ASSET_VERSION 1
+
+// Every asset starts on this boundary inside the archive
+#define PACKED_ASSET_ALIGNMENT 16
+
+// The bytes are XOR encrypted, as .ngt and .ngs files are
+#define PACKED_ASSET_FLAG_ENCRYPTED 1
+
+// Layout on disk, little endian:
+// PackedAssetHeader, then numEntries PackedAssetEntry sorted by nameHash, then the asset bytes
+typedef struct
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t numEntries;
+    uint32_t reserved;
+} PackedAssetHeader;
+
+typedef struct
+{
+    uint64_t nameHash;
+    uint64_t offset;
+    uint64_t size;
+    uint32_t flags;
+    uint32_t reserved;
+} PackedAssetEntry;
+
+// 64 bit FNV-1a of the asset's file name, e.g. "texture_001.ngt"
+static inline uint64_t packedAssetNameHash(const char* name)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    size_t len = strlen(name);
+    
+    for (size_t i = 0; i < len; ++i)
+    {
+        hash ^= (unsigned char) name[i];
+        hash *= 1099511628211ULL;
+    }
+    
+    return hash;
+}
+
+#endif /* defined(__noctisgames__PackedAssetFormat__) */
@@ -34,80 +34,91 @@
 #include <stdlib.h>
 #include <sstream>
 
-JsonFile::JsonFile(const char* filePath, bool useEncryption) : m_filePath(filePath), m_useEncryption(useEncryption)
-{
-    // Empty
-}
+#ifndef _WIN32
+#include <unistd.h>
+#endif
 
-void JsonFile::save()
+static std::string getFinalPath(const char* filePath)
 {
-    assert(m_filePath);
-    
-    using namespace rapidjson;
-    using namespace std;
-    
-    const char* finalPath;
 #if defined __ANDROID__
-    finalPath = ANDROID_ASSETS->getPathInsideApk(m_filePath);
+    return std::string(ANDROID_ASSETS->getPathInsideApk(filePath));
 #elif TARGET_OS_IPHONE
-    finalPath = getPathInsideNSDocuments(m_filePath);
+    return std::string(getPathInsideNSDocuments(filePath));
 #elif defined _WIN32
 	#if !defined(WINAPI_FAMILY) || WINAPI_FAMILY == WINAPI_FAMILY_DESKTOP_APP
-		finalPath = m_filePath;
+		return std::string(filePath);
 	#else
 		Windows::Storage::StorageFolder^ localFolder = Windows::Storage::ApplicationData::Current->LocalFolder;
 		Platform::String^ ps_path = localFolder->Path;
 		std::string s_path(ps_path->Begin(), ps_path->End());
-		const char* path = s_path.c_str(); // std::string to const
 		std::stringstream ss;
-		ss << path << "\\" << m_filePath;
+		ss << s_path << "\\" << filePath;
 
-		std::string finalPathS = ss.str();
-		finalPath = finalPathS.c_str();
+		return ss.str();
 	#endif
 #else
-    finalPath = m_filePath;
-#endif
-    
-    FILE *file;
-#ifdef _WIN32
-    errno_t err;
-    if ((err = fopen_s(&file, finalPath, "w+")) != 0)
-    {
-#else
-    if ((file = fopen(finalPath, "w+")) == NULL)
-    {
+    return std::string(filePath);
 #endif
-        return;
-    }
-    else
+}
+
+JsonFile::JsonFile(const char* filePath, bool useEncryption) :
+m_filePath(filePath),
+m_useEncryption(useEncryption),
+m_writer(nullptr),
+m_hasPendingSave(false),
+m_isWriting(false),
+m_isShuttingDown(false)
+{
+    // Empty
+}
+
+JsonFile::~JsonFile()
+{
+    if (m_writer)
     {
-        static StringBuffer s;
-        Writer<StringBuffer> w(s);
-        
-        s.Clear();
-        
-        w.StartObject();
-        
-        for (std::map<std::string, std::string>::iterator i = m_keyValues.begin(); i != m_keyValues.end(); ++i)
         {
-            w.String((*i).first.c_str());
-            w.String((*i).second.c_str());
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            m_isShuttingDown = true;
         }
         
-        w.EndObject();
-        
-        const char* data = s.GetString();
+        m_workAvailable.notify_one();
         
-        std::string rawData = std::string(data);
-        std::string dataToWrite = m_useEncryption ? StringUtil::encryptDecrypt(rawData) : rawData;
+        // The writer drains the pending save before it exits
+        m_writer->join();
         
-        int sum = fprintf(file, "%s", dataToWrite.c_str());
-        
-        UNUSED(sum);
+        delete m_writer;
+    }
+}
+
+void JsonFile::save()
+{
+    assert(m_filePath);
+    
+    // Resolved here, the platform path helpers are not safe to call off the main thread
+    std::string finalPath = getFinalPath(m_filePath);
+    
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
         
-        fclose(file);
+        m_pendingKeyValues = m_keyValues;
+        m_pendingPath = finalPath;
+        m_hasPendingSave = true;
     }
+    
+    if (!m_writer)
+    {
+        m_writer = new std::thread(&JsonFile::writerLoop, this);
+    }
+    
+    m_workAvailable.notify_one();
+}
+
+void JsonFile::flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    
+    m_idle.wait(lock, [this] { return !m_hasPendingSave && !m_isWriting; });
 }
 
 void JsonFile::load()
@@ -117,36 +128,17 @@ void JsonFile::load()
     using namespace rapidjson;
     using namespace std;
     
-    const char* finalPath;
-
-#if defined __ANDROID__
-    finalPath = ANDROID_ASSETS->getPathInsideApk(m_filePath);
-#elif TARGET_OS_IPHONE
-    finalPath = getPathInsideNSDocuments(m_filePath);
-#elif defined _WIN32
-	#if !defined(WINAPI_FAMILY) || WINAPI_FAMILY == WINAPI_FAMILY_DESKTOP_APP
-		finalPath = m_filePath;
-	#else
-		Windows::Storage::StorageFolder^ localFolder = Windows::Storage::ApplicationData::Current->LocalFolder;
-		Platform::String^ ps_path = localFolder->Path;
-		std::string s_path(ps_path->Begin(), ps_path->End());
-		const char* path = s_path.c_str(); // std::string to const
-		std::stringstream ss;
-		ss << path << "\\" << m_filePath;
-
-		std::string finalPathS = ss.str();
-		finalPath = finalPathS.c_str();
-	#endif
-#else
-    finalPath = m_filePath;
-#endif
+    // Never read back a file that a pending save is about to replace
+    flush();
+    
+    std::string finalPath = getFinalPath(m_filePath);
     
     FILE *file;
 #ifdef _WIN32
     errno_t err;
-    if ((err = fopen_s(&file, finalPath, "r")) != 0)
+    if ((err = fopen_s(&file, finalPath.c_str(), "r")) != 0)
 #else
-    if ((file = fopen(finalPath, "r")) == NULL)
+    if ((file = fopen(finalPath.c_str(), "r")) == NULL)
 #endif
     {
         return;
@@ -211,3 +203,105 @@ void JsonFile::setValue(std::string key, std::string value)
 {
     m_keyValues[key] = value;
 }
+
+#pragma mark private
+
+void JsonFile::writerLoop()
+{
+    while (true)
+    {
+        std::map<std::string, std::string> keyValues;
+        std::string finalPath;
+        
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            m_workAvailable.wait(lock, [this] { return m_isShuttingDown || m_hasPendingSave; });
+            
+            if (!m_hasPendingSave)
+            {
+                return;
+            }
+            
+            // Only the latest snapshot matters, anything saved before it is superseded
+            keyValues.swap(m_pendingKeyValues);
+            finalPath.swap(m_pendingPath);
+            
+            m_hasPendingSave = false;
+            m_isWriting = true;
+        }
+        
+        write(finalPath, keyValues);
+        
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            m_isWriting = false;
+        }
+        
+        m_idle.notify_all();
+    }
+}
+
+void JsonFile::write(const std::string& finalPath, const std::map<std::string, std::string>& keyValues)
+{
+    using namespace rapidjson;
+    
+    StringBuffer s;
+    Writer<StringBuffer> w(s);
+    
+    w.StartObject();
+    
+    for (std::map<std::string, std::string>::const_iterator i = keyValues.begin(); i != keyValues.end(); ++i)
+    {
+        w.String((*i).first.c_str());
+        w.String((*i).second.c_str());
+    }
+    
+    w.EndObject();
+    
+    std::string rawData = std::string(s.GetString());
+    std::string dataToWrite = m_useEncryption ? StringUtil::encryptDecrypt(rawData) : rawData;
+    
+    // Written next to the save and renamed over it, so a crash mid write leaves the old save intact
+    std::string tempPath = finalPath + ".tmp";
+    
+    FILE *file;
+#ifdef _WIN32
+    errno_t err;
+    if ((err = fopen_s(&file, tempPath.c_str(), "w")) != 0)
+#else
+    if ((file = fopen(tempPath.c_str(), "w")) == NULL)
+#endif
+    {
+        return;
+    }
+    
+    size_t written = fwrite(dataToWrite.data(), 1, dataToWrite.size(), file);
+    bool isWritten = written == dataToWrite.size() && fflush(file) == 0;
+    
+#ifndef _WIN32
+    isWritten = isWritten && fsync(fileno(file)) == 0;
+#endif
+    
+    isWritten = fclose(file) == 0 && isWritten;
+    
+    if (!isWritten)
+    {
+        remove(tempPath.c_str());
+        
+        return;
+    }
+    
+#if defined _WIN32
+	#if !defined(WINAPI_FAMILY) || WINAPI_FAMILY == WINAPI_FAMILY_DESKTOP_APP
+		MoveFileExA(tempPath.c_str(), finalPath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+	#else
+		// No atomic replace here, rename refuses to overwrite
+		remove(finalPath.c_str());
+		rename(tempPath.c_str(), finalPath.c_str());
+	#endif
+#else
+    rename(tempPath.c_str(), finalPath.c_str());
+#endif
+}
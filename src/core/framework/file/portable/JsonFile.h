@@ -11,14 +11,25 @@
 
 #include <map>
 #include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 class JsonFile
 {
 public:
     JsonFile(const char* filePath, bool useEncryption = false);
     
+    // Flushes any pending save
+    ~JsonFile();
+    
+    // Hands a snapshot to the writer thread and returns right away,
+    // a burst of saves before the writer gets to it is written once
     void save();
     
+    // Blocks until every save requested so far is on disk, call before the app can be killed
+    void flush();
+    
     void load();
     
     void clear();
@@ -31,6 +42,24 @@ private:
     const char* m_filePath;
     bool m_useEncryption;
     std::map<std::string, std::string> m_keyValues;
+    
+    std::thread* m_writer;
+    std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    std::condition_variable m_idle;
+    std::map<std::string, std::string> m_pendingKeyValues;
+    std::string m_pendingPath;
+    bool m_hasPendingSave;
+    bool m_isWriting;
+    bool m_isShuttingDown;
+    
+    void writerLoop();
+    
+    void write(const std::string& finalPath, const std::map<std::string, std::string>& keyValues);
+    
+    // Prevent copying
+    JsonFile(const JsonFile&);
+    JsonFile& operator=(const JsonFile&);
 };
 
 #endif /* defined(__noctisgames__JsonFile__) */
@@ -52,7 +52,7 @@ void Direct3DSpriteBatcher::endBatch(GpuTextureWrapper& textureWrapper, GpuProgr
 	}
 }
 
-void Direct3DSpriteBatcher::drawSprite(float x, float y, float width, float height, float angle, TextureRegion tr)
+void Direct3DSpriteBatcher::drawSprite(float x, float y, float width, float height, float angle, TextureRegion& tr)
 {
 	if (angle != 0)
 	{
@@ -100,7 +100,7 @@ void Direct3DSpriteBatcher::drawSprite(float x, float y, float width, float heig
 	m_iNumSprites++;
 }
 
-void Direct3DSpriteBatcher::drawSprite(float x, float y, float width, float height, float angle, Color &color, TextureRegion tr)
+void Direct3DSpriteBatcher::drawSprite(float x, float y, float width, float height, float angle, Color &color, TextureRegion& tr)
 {
 	if (angle != 0)
 	{
@@ -150,7 +150,7 @@ void Direct3DSpriteBatcher::drawSprite(float x, float y, float width, float heig
 
 #pragma mark <Private>
 
-void Direct3DSpriteBatcher::drawSprite(float x, float y, float width, float height, TextureRegion tr)
+void Direct3DSpriteBatcher::drawSprite(float x, float y, float width, float height, TextureRegion& tr)
 {
 	float halfWidth = width / 2;
 	float halfHeight = height / 2;
@@ -165,7 +165,7 @@ void Direct3DSpriteBatcher::drawSprite(float x, float y, float width, float heig
 	D3DManager->addVertexCoordinate(x2, y1, 0, 1, 1, 1, 1, tr.u2, tr.v2);
 }
 
-void Direct3DSpriteBatcher::drawSprite(float x, float y, float width, float height, Color &color, TextureRegion tr)
+void Direct3DSpriteBatcher::drawSprite(float x, float y, float width, float height, Color &color, TextureRegion& tr)
 {
 	float halfWidth = width / 2;
 	float halfHeight = height / 2;
@@ -23,10 +23,10 @@ void OpenGLGeometryProgram::bind()
     
     glUniformMatrix4fv(u_mvp_matrix_location, 1, GL_FALSE, (GLfloat*)OGLManager->getViewProjectionMatrix());
     
-    mapBuffer(OGLManager->getGbVboObject(), OGLManager->getColorVertices());
+    GLintptr offset = mapBuffer(OGLManager->getGbVboObject(), OGLManager->getColorVertices());
     
-    glVertexAttribPointer(a_position_location, 3, GL_FLOAT, GL_FALSE, sizeof(GLfloat) * 7, BUFFER_OFFSET(0));
-    glVertexAttribPointer(a_color_location, 4, GL_FLOAT, GL_FALSE, sizeof(GLfloat) * 7, BUFFER_OFFSET(3 * sizeof(GL_FLOAT)));
+    glVertexAttribPointer(a_position_location, 3, GL_FLOAT, GL_FALSE, sizeof(GLfloat) * 7, BUFFER_OFFSET(offset));
+    glVertexAttribPointer(a_color_location, 4, GL_FLOAT, GL_FALSE, sizeof(GLfloat) * 7, BUFFER_OFFSET(offset + 3 * sizeof(GL_FLOAT)));
     
     glEnableVertexAttribArray(a_position_location);
     glEnableVertexAttribArray(a_color_location);
@@ -48,6 +48,10 @@ void OpenGLManager::createDeviceDependentResources(int maxBatchSize)
     glGetIntegerv(GL_MAX_TEXTURE_SIZE, &m_iMaxTextureSize);
     
     generateIndices(maxBatchSize);
+    createIndexBufferObject();
+    
+    createStreamingBuffer(sb_vbo_object, sizeof(GLfloat) * 9 * VERTICES_PER_RECTANGLE * maxBatchSize * NUM_STREAMING_BUFFER_BATCHES);
+    createStreamingBuffer(gb_vbo_object, sizeof(GLfloat) * 7 * VERTICES_PER_LINE * 4 * maxBatchSize * NUM_STREAMING_BUFFER_BATCHES);
     
     if (m_iRenderWidth > -1
         && m_iRenderHeight > -1
@@ -77,10 +81,13 @@ void OpenGLManager::releaseDeviceDependentResources()
 {
     m_indices.clear();
     
+    glDeleteBuffers(1, &m_indexBufferObject);
+    m_indexBufferObject = 0;
+    
     releaseFramebuffers();
     
-    glDeleteBuffers(1, &sb_vbo_object);
-    glDeleteBuffers(1, &gb_vbo_object);
+    releaseStreamingBuffer(sb_vbo_object);
+    releaseStreamingBuffer(gb_vbo_object);
 }
 
 void OpenGLManager::createMatrix(float left, float right, float bottom, float top)
@@ -114,6 +121,36 @@ void OpenGLManager::addVertexCoordinate(GLfloat x, GLfloat y, GLfloat z, GLfloat
     m_colorVertices.push_back(a);
 }
 
+GLintptr OpenGLManager::streamVertices(OpenGLStreamingBuffer& buffer, std::vector<GLfloat>& vertices)
+{
+    GLsizeiptr size = sizeof(GLfloat) * vertices.size();
+    
+    glBindBuffer(GL_ARRAY_BUFFER, buffer.vbo);
+    
+    if (size > buffer.capacity)
+    {
+        buffer.capacity = size;
+        buffer.offset = 0;
+        
+        glBufferData(GL_ARRAY_BUFFER, buffer.capacity, NULL, GL_STREAM_DRAW);
+    }
+    else if (buffer.offset + size > buffer.capacity)
+    {
+        // Orphan the full buffer so the driver can hand back fresh storage instead of waiting on draws still in flight
+        buffer.offset = 0;
+        
+        glBufferData(GL_ARRAY_BUFFER, buffer.capacity, NULL, GL_STREAM_DRAW);
+    }
+    
+    GLintptr offset = buffer.offset;
+    
+    glBufferSubData(GL_ARRAY_BUFFER, offset, size, &vertices[0]);
+    
+    buffer.offset += size;
+    
+    return offset;
+}
+
 void OpenGLManager::useNormalBlending()
 {
     glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO);
@@ -137,6 +174,11 @@ std::vector<GLshort>& OpenGLManager::getIndices()
     return m_indices;
 }
 
+GLuint& OpenGLManager::getIndexBufferObject()
+{
+    return m_indexBufferObject;
+}
+
 std::vector<GLuint>& OpenGLManager::getFbos()
 {
     return m_fbos;
@@ -162,12 +204,12 @@ std::vector<GLfloat>& OpenGLManager::getColorVertices()
     return m_colorVertices;
 }
 
-GLuint& OpenGLManager::getSbVboObject()
+OpenGLStreamingBuffer& OpenGLManager::getSbVboObject()
 {
     return sb_vbo_object;
 }
 
-GLuint& OpenGLManager::getGbVboObject()
+OpenGLStreamingBuffer& OpenGLManager::getGbVboObject()
 {
     return gb_vbo_object;
 }
@@ -225,6 +267,34 @@ void OpenGLManager::generateIndices(int maxBatchSize)
     }
 }
 
+void OpenGLManager::createIndexBufferObject()
+{
+    glGenBuffers(1, &m_indexBufferObject);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBufferObject);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLshort) * m_indices.size(), &m_indices[0], GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+void OpenGLManager::createStreamingBuffer(OpenGLStreamingBuffer& buffer, GLsizeiptr capacity)
+{
+    buffer.capacity = capacity;
+    buffer.offset = 0;
+    
+    glGenBuffers(1, &buffer.vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer.vbo);
+    glBufferData(GL_ARRAY_BUFFER, buffer.capacity, NULL, GL_STREAM_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void OpenGLManager::releaseStreamingBuffer(OpenGLStreamingBuffer& buffer)
+{
+    glDeleteBuffers(1, &buffer.vbo);
+    
+    buffer.vbo = 0;
+    buffer.capacity = 0;
+    buffer.offset = 0;
+}
+
 void OpenGLManager::createFramebufferObjects()
 {
     for (int i = 0; i < m_iNumFramebuffers; ++i)
@@ -285,9 +355,17 @@ void OpenGLManager::releaseFramebuffers()
     NGSTDUtil::cleanUpVectorOfPointers(m_framebuffers);
 }
 
-OpenGLManager::OpenGLManager() : sb_vbo_object(0), gb_vbo_object(0), m_iScreenFBO(0), m_iMaxTextureSize(64), m_iRenderWidth(-1), m_iRenderHeight(-1), m_iNumFramebuffers(-1)
+OpenGLManager::OpenGLManager() : m_indexBufferObject(0), m_iScreenFBO(0), m_iMaxTextureSize(64), m_iRenderWidth(-1), m_iRenderHeight(-1), m_iNumFramebuffers(-1)
 {
     // Hide Constructor for Singleton
+    
+    sb_vbo_object.vbo = 0;
+    sb_vbo_object.capacity = 0;
+    sb_vbo_object.offset = 0;
+    
+    gb_vbo_object.vbo = 0;
+    gb_vbo_object.capacity = 0;
+    gb_vbo_object.offset = 0;
 }
 
 OpenGLManager::~OpenGLManager()
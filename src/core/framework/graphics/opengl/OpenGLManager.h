@@ -16,11 +16,19 @@
 #define VERTICES_PER_LINE 2
 #define VERTICES_PER_RECTANGLE 4
 #define INDICES_PER_RECTANGLE 6
+#define NUM_STREAMING_BUFFER_BATCHES 8
 
 #define OGLManager (OpenGLManager::getInstance())
 
 struct GpuTextureWrapper;
 
+struct OpenGLStreamingBuffer
+{
+    GLuint vbo;
+    GLsizeiptr capacity;
+    GLintptr offset;
+};
+
 typedef float vec4[4];
 typedef vec4 mat4x4[4];
 
@@ -70,19 +78,23 @@ public:
     void addVertexCoordinate(GLfloat x, GLfloat y, GLfloat z, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat u, GLfloat v);
     void addVertexCoordinate(GLfloat x, GLfloat y, GLfloat z, GLfloat r, GLfloat g, GLfloat b, GLfloat a);
     
+    // Called by Programs, returns the byte offset the vertices were written to
+    GLintptr streamVertices(OpenGLStreamingBuffer& buffer, std::vector<GLfloat>& vertices);
+    
     void useNormalBlending();
     void useScreenBlending();
     
     void setScreenSize(int screenWidth, int screenHeight);
     
     std::vector<GLshort>& getIndices();
+    GLuint& getIndexBufferObject();
     std::vector<GLuint>& getFbos();
     std::vector<GLuint>& getFboTextures();
     std::vector<GpuTextureWrapper *>& getFramebuffers();
     std::vector<GLfloat>& getTextureVertices();
     std::vector<GLfloat>& getColorVertices();
-    GLuint& getSbVboObject(); // For Sprite Batcher
-    GLuint& getGbVboObject(); // For Geometry Batcher
+    OpenGLStreamingBuffer& getSbVboObject(); // For Sprite Batcher
+    OpenGLStreamingBuffer& getGbVboObject(); // For Geometry Batcher
     GLint& getScreenFBO();
     GLint& getMaxTextureSize();
     mat4x4& getViewProjectionMatrix();
@@ -95,6 +107,7 @@ private:
     static OpenGLManager* s_pInstance;
     
     std::vector<GLshort> m_indices;
+    GLuint m_indexBufferObject;
     
     std::vector<GLuint> m_fbos;
     std::vector<GLuint> m_fbo_textures;
@@ -104,8 +117,8 @@ private:
     std::vector<GLfloat> m_textureVertices;
     std::vector<GLfloat> m_colorVertices;
     
-    GLuint sb_vbo_object; // For Sprite Batcher
-    GLuint gb_vbo_object; // For Geometry Batcher
+    OpenGLStreamingBuffer sb_vbo_object; // For Sprite Batcher
+    OpenGLStreamingBuffer gb_vbo_object; // For Geometry Batcher
     
     GLint m_iScreenFBO;
     GLint m_iMaxTextureSize;
@@ -119,6 +132,9 @@ private:
     int m_iNumFramebuffers;
     
     void generateIndices(int maxBatchSize);
+    void createIndexBufferObject();
+    void createStreamingBuffer(OpenGLStreamingBuffer& buffer, GLsizeiptr capacity);
+    void releaseStreamingBuffer(OpenGLStreamingBuffer& buffer);
     void createFramebufferObjects();
     void createFramebufferObject();
     void releaseFramebuffers();
@@ -34,7 +34,11 @@ void OpenGLNGRectBatcher::endBatch(GpuProgramWrapper &gpuProgramWrapper)
         
         if (m_isFill)
         {
-            glDrawElements(GL_TRIANGLES, m_iNumNGRects * INDICES_PER_RECTANGLE, GL_UNSIGNED_SHORT, &OGLManager->getIndices()[0]);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, OGLManager->getIndexBufferObject());
+            
+            glDrawElements(GL_TRIANGLES, m_iNumNGRects * INDICES_PER_RECTANGLE, GL_UNSIGNED_SHORT, 0);
+            
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
         }
         else
         {
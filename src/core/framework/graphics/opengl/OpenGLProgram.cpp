@@ -89,18 +89,14 @@ GLuint OpenGLProgram::getProgramObjectId()
     return m_programObjectId;
 }
 
-void OpenGLProgram::mapBuffer(GLuint& vbo, std::vector<GLfloat>& vertices)
+GLintptr OpenGLProgram::mapBuffer(OpenGLStreamingBuffer& buffer, std::vector<GLfloat>& vertices)
 {
-    glGenBuffers(1, &vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * vertices.size(), &vertices[0], GL_STATIC_DRAW);
+    return OGLManager->streamVertices(buffer, vertices);
 }
 
-void OpenGLProgram::unmapBuffer(GLuint& vbo)
+void OpenGLProgram::unmapBuffer(OpenGLStreamingBuffer& buffer)
 {
     glBindBuffer(GL_ARRAY_BUFFER, 0);
-    
-    glDeleteBuffers(1, &vbo);
 }
 
 GLuint OpenGLProgram::buildProgram(const void * vertex_shader_source, const int vertex_shader_source_length, const void * fragment_shader_source, const int fragment_shader_source_length)
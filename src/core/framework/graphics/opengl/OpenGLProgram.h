@@ -13,6 +13,8 @@
 
 #include <vector>
 
+struct OpenGLStreamingBuffer;
+
 #define BUFFER_OFFSET(i) ((void*)(i))
 
 class OpenGLProgram
@@ -31,9 +33,9 @@ public:
 protected:
     GLuint m_programObjectId;
     
-    void mapBuffer(GLuint& vbo, std::vector<GLfloat>& vertices);
+    GLintptr mapBuffer(OpenGLStreamingBuffer& buffer, std::vector<GLfloat>& vertices);
     
-    void unmapBuffer(GLuint& vbo);
+    void unmapBuffer(OpenGLStreamingBuffer& buffer);
     
 private:
     GLuint buildProgram(const void * vertex_shader_source, const int vertex_shader_source_length, const void * fragment_shader_source, const int fragment_shader_source_length);
@@ -39,7 +39,11 @@ void OpenGLSpriteBatcher::endBatch(GpuTextureWrapper& textureWrapper, GpuProgram
         
         gpuProgramWrapper.bind();
         
-        glDrawElements(GL_TRIANGLES, m_iNumSprites * INDICES_PER_RECTANGLE, GL_UNSIGNED_SHORT, &OGLManager->getIndices()[0]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, OGLManager->getIndexBufferObject());
+        
+        glDrawElements(GL_TRIANGLES, m_iNumSprites * INDICES_PER_RECTANGLE, GL_UNSIGNED_SHORT, 0);
+        
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
         
         gpuProgramWrapper.unbind();
         
@@ -48,7 +52,7 @@ void OpenGLSpriteBatcher::endBatch(GpuTextureWrapper& textureWrapper, GpuProgram
     }
 }
 
-void OpenGLSpriteBatcher::drawSprite(float x, float y, float width, float height, float angle, TextureRegion tr)
+void OpenGLSpriteBatcher::drawSprite(float x, float y, float width, float height, float angle, TextureRegion& tr)
 {
     if (angle != 0)
     {
@@ -96,7 +100,7 @@ void OpenGLSpriteBatcher::drawSprite(float x, float y, float width, float height
     m_iNumSprites++;
 }
 
-void OpenGLSpriteBatcher::drawSprite(float x, float y, float width, float height, float angle, Color &c, TextureRegion tr)
+void OpenGLSpriteBatcher::drawSprite(float x, float y, float width, float height, float angle, Color &c, TextureRegion& tr)
 {
     if (angle != 0)
     {
@@ -146,7 +150,7 @@ void OpenGLSpriteBatcher::drawSprite(float x, float y, float width, float height
 
 #pragma private methods
 
-void OpenGLSpriteBatcher::drawSprite(float x, float y, float width, float height, TextureRegion tr)
+void OpenGLSpriteBatcher::drawSprite(float x, float y, float width, float height, TextureRegion& tr)
 {
     GLfloat halfWidth = width / 2;
     GLfloat halfHeight = height / 2;
@@ -161,7 +165,7 @@ void OpenGLSpriteBatcher::drawSprite(float x, float y, float width, float height
     OGLManager->addVertexCoordinate(x2, y1, 0, 1, 1, 1, 1, tr.u2, tr.v2);
 }
 
-void OpenGLSpriteBatcher::drawSprite(float x, float y, float width, float height, Color &c, TextureRegion tr)
+void OpenGLSpriteBatcher::drawSprite(float x, float y, float width, float height, Color &c, TextureRegion& tr)
 {
     GLfloat halfWidth = width / 2;
     GLfloat halfHeight = height / 2;
@@ -21,6 +21,7 @@ extern "C"
 }
 
 #include <string>
+#include <chrono>
 #include <assert.h>
 #include <stdlib.h>
 
@@ -48,19 +49,21 @@ GpuTextureDataWrapper* OpenGLTextureLoader::loadTextureData(const char* textureN
     textureFileName[len+4] = '\0';
     
     const FileData png_file = AssetDataHandler::getAssetDataHandler()->getAssetData(textureFileName);
-    unsigned char* output = (unsigned char*) malloc(png_file.data_length);
-    StringUtil::encryptDecrypt((unsigned char*)png_file.data, output, png_file.data_length);
     
-    const PngImageData raw_image_data = getPngImageDataFromFileData(output, (int)png_file.data_length);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    
+    // No decrypted copy of the file, libpng reads straight from the asset data
+    float decrypt_ms = 0;
+    const PngImageData raw_image_data = getPngImageDataFromFileData(png_file.data, (int)png_file.data_length, true, decrypt_ms);
+    
+    float total_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
     
     AssetDataHandler::getAssetDataHandler()->releaseAssetData(&png_file);
     
-    GpuTextureDataWrapper* tdw = new GpuTextureDataWrapper(raw_image_data);
+    GpuTextureDataWrapper* tdw = new GpuTextureDataWrapper(raw_image_data, decrypt_ms, total_ms - decrypt_ms);
     
     delete[] textureFileName;
     
-    free((void *)output);
-    
     return tdw;
 }
 
@@ -69,6 +72,54 @@ GpuTextureWrapper* OpenGLTextureLoader::loadTexture(GpuTextureDataWrapper* textu
     return new GpuTextureWrapper(loadPngAssetIntoTexture(textureData->raw_image_data, repeatS));
 }
 
+int OpenGLTextureLoader::getTextureDataSize(GpuTextureDataWrapper* textureData)
+{
+    return textureData->raw_image_data.size;
+}
+
+int OpenGLTextureLoader::getTextureDataNumRows(GpuTextureDataWrapper* textureData)
+{
+    return textureData->raw_image_data.height;
+}
+
+float OpenGLTextureLoader::getTextureDataDecryptTime(GpuTextureDataWrapper* textureData)
+{
+    return textureData->decryptTime;
+}
+
+float OpenGLTextureLoader::getTextureDataDecodeTime(GpuTextureDataWrapper* textureData)
+{
+    return textureData->decodeTime;
+}
+
+GpuTextureWrapper* OpenGLTextureLoader::createTextureStorage(GpuTextureDataWrapper* textureData, bool repeatS)
+{
+    const PngImageData& pngImageData = textureData->raw_image_data;
+    
+    return new GpuTextureWrapper(createTexture(pngImageData.width, pngImageData.height, pngImageData.gl_color_format, NULL, repeatS, 0));
+}
+
+void OpenGLTextureLoader::loadTextureRows(GpuTextureWrapper* texture, GpuTextureDataWrapper* textureData, int firstRow, int numRows)
+{
+    const PngImageData& pngImageData = textureData->raw_image_data;
+    
+    assert(firstRow >= 0 && numRows > 0 && firstRow + numRows <= pngImageData.height);
+    
+    const int rowSize = pngImageData.size / pngImageData.height;
+    const unsigned char* pixels = (const unsigned char*) pngImageData.data + firstRow * rowSize;
+    
+    glBindTexture(GL_TEXTURE_2D, texture->texture);
+    
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, firstRow, pngImageData.width, numRows, pngImageData.gl_color_format, GL_UNSIGNED_BYTE, pixels);
+    
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void OpenGLTextureLoader::releaseTextureData(GpuTextureDataWrapper* textureData)
+{
+    releasePngImageData(&textureData->raw_image_data);
+}
+
 struct DataHandle
 {
     const png_byte* data;
@@ -79,6 +130,8 @@ struct ReadDataHandle
 {
     const DataHandle data;
     png_size_t offset;
+    const bool is_encrypted;
+    float decrypt_ms;
 };
 
 struct PngInfo
@@ -96,10 +149,21 @@ static DataHandle readEntirePngImage(const png_structp png_ptr, const png_infop
 
 static GLenum getGlColorFormat(const int png_color_format);
 
-PngImageData OpenGLTextureLoader::getPngImageDataFromFileData(const void* png_data, const int png_data_size)
+PngImageData OpenGLTextureLoader::getPngImageDataFromFileData(const void* png_data, const int png_data_size, const bool is_encrypted, float& decrypt_ms)
 {
     assert(png_data != NULL && png_data_size > 8);
-    assert(png_check_sig((png_const_bytep)png_data, 8));
+    
+    png_byte png_sig[8];
+    if (is_encrypted)
+    {
+        StringUtil::encryptDecrypt((const unsigned char*)png_data, png_sig, 8, 0);
+    }
+    else
+    {
+        memcpy(png_sig, png_data, 8);
+    }
+    
+    assert(png_check_sig(png_sig, 8));
     
     png_structp png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
     assert(png_ptr != NULL);
@@ -110,7 +174,7 @@ PngImageData OpenGLTextureLoader::getPngImageDataFromFileData(const void* png_da
     {
         {
             (png_byte*) png_data, static_cast<png_size_t>(png_data_size)
-        }, 0
+        }, 0, is_encrypted, 0
     };
     png_set_read_fn(png_ptr, &png_data_handle, readPngDataCallback);
     
@@ -125,6 +189,8 @@ PngImageData OpenGLTextureLoader::getPngImageDataFromFileData(const void* png_da
     png_read_end(png_ptr, info_ptr);
     png_destroy_read_struct(&png_ptr, &info_ptr, NULL);
     
+    decrypt_ms = png_data_handle.decrypt_ms;
+    
     return (PngImageData)
     {
         static_cast<int>(png_info.width),
@@ -146,7 +212,20 @@ static void readPngDataCallback(png_structp png_ptr, png_byte* raw_data, png_siz
     ReadDataHandle* handle = (ReadDataHandle*) png_get_io_ptr(png_ptr);
     const png_byte* png_src = handle->data.data + handle->offset;
     
-    memcpy(raw_data, png_src, read_length);
+    if (handle->is_encrypted)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        
+        // The offset picks up the key where the previous read left off
+        StringUtil::encryptDecrypt(png_src, raw_data, (long) read_length, (long) handle->offset);
+        
+        handle->decrypt_ms += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    else
+    {
+        memcpy(raw_data, png_src, read_length);
+    }
+    
     handle->offset += read_length;
 }
 
@@ -26,8 +26,23 @@ public:
     
     virtual GpuTextureWrapper* loadTexture(GpuTextureDataWrapper* textureData, bool repeatS = false);
     
+    virtual int getTextureDataSize(GpuTextureDataWrapper* textureData);
+    
+    virtual int getTextureDataNumRows(GpuTextureDataWrapper* textureData);
+    
+    virtual float getTextureDataDecryptTime(GpuTextureDataWrapper* textureData);
+    
+    virtual float getTextureDataDecodeTime(GpuTextureDataWrapper* textureData);
+    
+    virtual GpuTextureWrapper* createTextureStorage(GpuTextureDataWrapper* textureData, bool repeatS = false);
+    
+    virtual void loadTextureRows(GpuTextureWrapper* texture, GpuTextureDataWrapper* textureData, int firstRow, int numRows);
+    
+    virtual void releaseTextureData(GpuTextureDataWrapper* textureData);
+    
 private:
-    PngImageData getPngImageDataFromFileData(const void* png_data, const int png_data_size);
+    // Encrypted data is decrypted as libpng pulls it in, decrypt_ms gets the time spent doing so
+    PngImageData getPngImageDataFromFileData(const void* png_data, const int png_data_size, const bool is_encrypted, float& decrypt_ms);
     
     void releasePngImageData(const PngImageData* data);
     
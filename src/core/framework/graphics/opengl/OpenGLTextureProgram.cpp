@@ -27,11 +27,11 @@ void OpenGLTextureProgram::bind()
     
     glUniform1i(u_texture_unit_location, 0);
     
-    mapBuffer(OGLManager->getSbVboObject(), OGLManager->getTextureVertices());
+    GLintptr offset = mapBuffer(OGLManager->getSbVboObject(), OGLManager->getTextureVertices());
     
-    glVertexAttribPointer(a_position_location, 3, GL_FLOAT, GL_FALSE, sizeof(GLfloat) * 9, BUFFER_OFFSET(0));
-    glVertexAttribPointer(a_color_location, 4, GL_FLOAT, GL_FALSE, sizeof(GLfloat) * 9, BUFFER_OFFSET(3 * sizeof(GL_FLOAT)));
-    glVertexAttribPointer(a_texture_coordinates_location, 2, GL_FLOAT, GL_FALSE, sizeof(GLfloat) * 9, BUFFER_OFFSET(7 * sizeof(GL_FLOAT)));
+    glVertexAttribPointer(a_position_location, 3, GL_FLOAT, GL_FALSE, sizeof(GLfloat) * 9, BUFFER_OFFSET(offset));
+    glVertexAttribPointer(a_color_location, 4, GL_FLOAT, GL_FALSE, sizeof(GLfloat) * 9, BUFFER_OFFSET(offset + 3 * sizeof(GL_FLOAT)));
+    glVertexAttribPointer(a_texture_coordinates_location, 2, GL_FLOAT, GL_FALSE, sizeof(GLfloat) * 9, BUFFER_OFFSET(offset + 7 * sizeof(GL_FLOAT)));
     
     glEnableVertexAttribArray(a_position_location);
     glEnableVertexAttribArray(a_color_location);
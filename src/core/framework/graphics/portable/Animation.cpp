@@ -14,12 +14,12 @@
 
 #include <stdarg.h>
 
-Animation::Animation(std::string textureName, int x, int y, int regionWidth, int regionHeight, int animationWidth, int animationHeight, int textureWidth, int textureHeight, bool looping, int numFrames) : m_textureName(textureName), m_fCycleTime(0), m_iFirstLoopingFrame(0), m_looping(looping)
+Animation::Animation(std::string textureName, int x, int y, int regionWidth, int regionHeight, int animationWidth, int animationHeight, int textureWidth, int textureHeight, bool looping, int numFrames) : m_iTextureId(TextureRegion::internTextureName(textureName)), m_fCycleTime(0), m_iFirstLoopingFrame(0), m_looping(looping)
 {
 	loadTextureRegions(x, y, regionWidth, regionHeight, animationWidth, animationHeight, textureWidth, textureHeight, numFrames);
 }
 
-Animation::Animation(std::string textureName, int x, int y, int regionWidth, int regionHeight, int animationWidth, int animationHeight, int textureWidth, int textureHeight, bool looping, float frameTime, int numFrames, int firstLoopingFrame, int xPadding, int yPadding) : m_textureName(textureName), m_fCycleTime(0), m_iFirstLoopingFrame(firstLoopingFrame), m_looping(looping)
+Animation::Animation(std::string textureName, int x, int y, int regionWidth, int regionHeight, int animationWidth, int animationHeight, int textureWidth, int textureHeight, bool looping, float frameTime, int numFrames, int firstLoopingFrame, int xPadding, int yPadding) : m_iTextureId(TextureRegion::internTextureName(textureName)), m_fCycleTime(0), m_iFirstLoopingFrame(firstLoopingFrame), m_looping(looping)
 {
 	loadTextureRegions(x, y, regionWidth, regionHeight, animationWidth, animationHeight, textureWidth, textureHeight, numFrames, xPadding, yPadding);
 
@@ -109,6 +109,11 @@ bool Animation::hasFrameTimes()
     return m_frameTimes.size() > 0;
 }
 
+std::string& Animation::getTextureName()
+{
+    return TextureRegion::getTextureName(m_iTextureId);
+}
+
 void Animation::loadTextureRegions(int x, int y, int regionWidth, int regionHeight, int animationWidth, int animationHeight, int textureWidth, int textureHeight, int numFrames, int xPadding, int yPadding)
 {
 	int right = x + animationWidth;
@@ -118,7 +123,7 @@ void Animation::loadTextureRegions(int x, int y, int regionWidth, int regionHeig
 	{
 		for (int i = x; i < right; i += regionWidth + xPadding)
 		{
-			TextureRegion tr = TextureRegion(m_textureName, i, j, regionWidth, regionHeight, textureWidth, textureHeight);
+			TextureRegion tr = TextureRegion(m_iTextureId, i, j, regionWidth, regionHeight, textureWidth, textureHeight);
 			m_textureRegions.push_back(tr);
 			numTextureRegionsAdded++;
 
@@ -33,12 +33,12 @@ public:
     
     bool hasFrameTimes();
     
-    std::string& getTextureName() { return m_textureName; }
+    std::string& getTextureName();
     
 private:
     std::vector<TextureRegion> m_textureRegions;
     std::vector<float> m_frameTimes;
-    std::string m_textureName;
+    int m_iTextureId;
     float m_fCycleTime;
     int m_iFirstLoopingFrame;
     bool m_looping;
@@ -16,12 +16,13 @@
 
 Font::Font(std::string textureName, int offsetX, int offsetY, int glyphsPerRow, int glyphWidth, int glyphHeight, int textureWidth, int textureHeight)
 {
+	int textureId = TextureRegion::internTextureName(textureName);
 	int x = offsetX;
 	int y = offsetY;
 
 	for (int i = 0; i < 176; ++i)
 	{
-		m_glyphs.push_back(TextureRegion(textureName, x, y, glyphWidth, glyphHeight, textureWidth, textureHeight));
+		m_glyphs.push_back(TextureRegion(textureId, x, y, glyphWidth, glyphHeight, textureWidth, textureHeight));
 
 		x += glyphWidth;
 
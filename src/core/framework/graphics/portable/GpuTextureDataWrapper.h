@@ -19,8 +19,10 @@ struct GpuTextureDataWrapper
 {
 #if defined __APPLE__ || defined __ANDROID__
     PngImageData raw_image_data;
+    float decryptTime;
+    float decodeTime;
     
-    GpuTextureDataWrapper(PngImageData raw_image_data_in) : raw_image_data(raw_image_data_in) {}
+    GpuTextureDataWrapper(PngImageData raw_image_data_in, float decryptTimeIn = 0, float decodeTimeIn = 0) : raw_image_data(raw_image_data_in), decryptTime(decryptTimeIn), decodeTime(decodeTimeIn) {}
 #elif defined _WIN32
     ID3D11ShaderResourceView* texture;
 
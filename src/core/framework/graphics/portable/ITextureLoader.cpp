@@ -10,6 +10,8 @@
 
 #include "ITextureLoader.h"
 
+#include <assert.h>
+
 ITextureLoader::ITextureLoader()
 {
     // Empty
@@ -19,3 +21,41 @@ ITextureLoader::~ITextureLoader()
 {
     // Empty
 }
+
+int ITextureLoader::getTextureDataSize(GpuTextureDataWrapper* textureData)
+{
+    return 0;
+}
+
+int ITextureLoader::getTextureDataNumRows(GpuTextureDataWrapper* textureData)
+{
+    // 0 means the texture can only be uploaded in one go via loadTexture
+    return 0;
+}
+
+float ITextureLoader::getTextureDataDecryptTime(GpuTextureDataWrapper* textureData)
+{
+    return 0;
+}
+
+float ITextureLoader::getTextureDataDecodeTime(GpuTextureDataWrapper* textureData)
+{
+    return 0;
+}
+
+GpuTextureWrapper* ITextureLoader::createTextureStorage(GpuTextureDataWrapper* textureData, bool repeatS)
+{
+    assert(false);
+    
+    return nullptr;
+}
+
+void ITextureLoader::loadTextureRows(GpuTextureWrapper* texture, GpuTextureDataWrapper* textureData, int firstRow, int numRows)
+{
+    assert(false);
+}
+
+void ITextureLoader::releaseTextureData(GpuTextureDataWrapper* textureData)
+{
+    // Empty
+}
@@ -22,6 +22,21 @@ public:
     virtual GpuTextureDataWrapper* loadTextureData(const char* textureName) = 0;
     
     virtual GpuTextureWrapper* loadTexture(GpuTextureDataWrapper* textureData, bool repeatS = false) = 0;
+    
+    virtual int getTextureDataSize(GpuTextureDataWrapper* textureData);
+    
+    virtual int getTextureDataNumRows(GpuTextureDataWrapper* textureData);
+    
+    // In milliseconds, 0 for loaders that don't measure it
+    virtual float getTextureDataDecryptTime(GpuTextureDataWrapper* textureData);
+    
+    virtual float getTextureDataDecodeTime(GpuTextureDataWrapper* textureData);
+    
+    virtual GpuTextureWrapper* createTextureStorage(GpuTextureDataWrapper* textureData, bool repeatS = false);
+    
+    virtual void loadTextureRows(GpuTextureWrapper* texture, GpuTextureDataWrapper* textureData, int firstRow, int numRows);
+    
+    virtual void releaseTextureData(GpuTextureDataWrapper* textureData);
 };
 
 #endif /* defined(__noctisgames__ITextureLoader__) */
@@ -26,16 +26,16 @@ public:
 
     virtual void endBatch(GpuTextureWrapper& textureWrapper, GpuProgramWrapper &gpuProgramWrapper) = 0;
 
-    virtual void drawSprite(float x, float y, float width, float height, float angle, TextureRegion tr) = 0;
+    virtual void drawSprite(float x, float y, float width, float height, float angle, TextureRegion& tr) = 0;
 
-    virtual void drawSprite(float x, float y, float width, float height, float angle, Color &c, TextureRegion tr) = 0;
+    virtual void drawSprite(float x, float y, float width, float height, float angle, Color &c, TextureRegion& tr) = 0;
 
 protected:
     int m_iNumSprites;
 
-    virtual void drawSprite(float x, float y, float width, float height, TextureRegion tr) = 0;
+    virtual void drawSprite(float x, float y, float width, float height, TextureRegion& tr) = 0;
 
-    virtual void drawSprite(float x, float y, float width, float height, Color &c, TextureRegion tr) = 0;
+    virtual void drawSprite(float x, float y, float width, float height, Color &c, TextureRegion& tr) = 0;
 };
 
 #endif /* defined(__noctisgames__SpriteBatcher__) */
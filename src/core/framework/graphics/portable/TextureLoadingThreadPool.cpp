@@ -0,0 +1,215 @@
+//
+//  TextureLoadingThreadPool.cpp
+//  noctisgames-framework
+//
+
+#include "pch.h"
+
+#include "TextureLoadingThreadPool.h"
+
+#include "ITextureLoader.h"
+#include "TextureWrapper.h"
+#include "GpuTextureDataWrapper.h"
+
+#include "NGSTDUtil.h"
+
+#include <algorithm>
+#include <assert.h>
+
+static bool compareTextureLoadingRequests(const TextureLoadingRequest& a, const TextureLoadingRequest& b)
+{
+    // Max heap on priority, first in first out within a priority
+    if (a.priority != b.priority)
+    {
+        return a.priority < b.priority;
+    }
+    
+    return a.sequence > b.sequence;
+}
+
+TextureLoadingThreadPool::TextureLoadingThreadPool(ITextureLoader* textureLoader) :
+m_textureLoader(textureLoader),
+m_iSequence(0),
+m_iNumBusy(0),
+m_isShuttingDown(false)
+{
+    assert(m_textureLoader != nullptr);
+}
+
+TextureLoadingThreadPool::~TextureLoadingThreadPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        
+        m_pending.clear();
+        m_isShuttingDown = true;
+    }
+    
+    m_workAvailable.notify_all();
+    
+    for (std::vector<std::thread *>::iterator i = m_threads.begin(); i != m_threads.end(); ++i)
+    {
+        (*i)->join();
+    }
+    
+    NGSTDUtil::cleanUpVectorOfPointers(m_threads);
+    
+    for (std::vector<TextureLoadingResult>::iterator i = m_results.begin(); i != m_results.end(); ++i)
+    {
+        delete (*i).gpuTextureDataWrapper;
+    }
+}
+
+void TextureLoadingThreadPool::enqueue(TextureWrapper* textureWrapper, int priority)
+{
+    assert(textureWrapper != nullptr);
+    
+    if (m_threads.size() == 0)
+    {
+        startThreads();
+    }
+    
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        
+        TextureLoadingRequest request;
+        request.textureWrapper = textureWrapper;
+        request.name = textureWrapper->name;
+        request.priority = priority;
+        request.sequence = m_iSequence++;
+        
+        m_pending.push_back(request);
+        std::push_heap(m_pending.begin(), m_pending.end(), compareTextureLoadingRequests);
+    }
+    
+    m_workAvailable.notify_one();
+}
+
+void TextureLoadingThreadPool::prioritize(TextureWrapper* textureWrapper, int priority)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    
+    bool isChanged = false;
+    for (std::vector<TextureLoadingRequest>::iterator i = m_pending.begin(); i != m_pending.end(); ++i)
+    {
+        if ((*i).textureWrapper == textureWrapper
+            && (*i).priority < priority)
+        {
+            (*i).priority = priority;
+            isChanged = true;
+        }
+    }
+    
+    if (isChanged)
+    {
+        std::make_heap(m_pending.begin(), m_pending.end(), compareTextureLoadingRequests);
+    }
+}
+
+void TextureLoadingThreadPool::cancel(TextureWrapper* textureWrapper)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    
+    size_t numPending = m_pending.size();
+    for (std::vector<TextureLoadingRequest>::iterator i = m_pending.begin(); i != m_pending.end(); )
+    {
+        if ((*i).textureWrapper == textureWrapper)
+        {
+            i = m_pending.erase(i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    
+    if (m_pending.size() != numPending)
+    {
+        std::make_heap(m_pending.begin(), m_pending.end(), compareTextureLoadingRequests);
+    }
+    
+    // A decode already in flight still lands in the results, the caller discards it
+}
+
+void TextureLoadingThreadPool::cancelAll()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        
+        m_pending.clear();
+    }
+    
+    m_idle.notify_all();
+}
+
+void TextureLoadingThreadPool::waitUntilIdle()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    
+    m_idle.wait(lock, [this] { return m_pending.size() == 0 && m_iNumBusy == 0; });
+}
+
+void TextureLoadingThreadPool::takeResults(std::vector<TextureLoadingResult>& results)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    
+    results.insert(results.end(), m_results.begin(), m_results.end());
+    m_results.clear();
+}
+
+#pragma mark private
+
+void TextureLoadingThreadPool::startThreads()
+{
+    int numThreads = (int) std::thread::hardware_concurrency() - 1;
+    
+    // Leave a core for the render thread, never oversubscribe
+    numThreads = std::max(1, std::min(numThreads, MAX_NUM_TEXTURE_LOADING_THREADS));
+    
+    for (int i = 0; i < numThreads; ++i)
+    {
+        m_threads.push_back(new std::thread(&TextureLoadingThreadPool::workerLoop, this));
+    }
+}
+
+void TextureLoadingThreadPool::workerLoop()
+{
+    while (true)
+    {
+        TextureLoadingRequest request;
+        
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            m_workAvailable.wait(lock, [this] { return m_isShuttingDown || m_pending.size() > 0; });
+            
+            if (m_isShuttingDown)
+            {
+                return;
+            }
+            
+            std::pop_heap(m_pending.begin(), m_pending.end(), compareTextureLoadingRequests);
+            request = m_pending.back();
+            m_pending.pop_back();
+            
+            m_iNumBusy++;
+        }
+        
+        GpuTextureDataWrapper* gpuTextureDataWrapper = m_textureLoader->loadTextureData(request.name.c_str());
+        
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            TextureLoadingResult result;
+            result.textureWrapper = request.textureWrapper;
+            result.name = request.name;
+            result.gpuTextureDataWrapper = gpuTextureDataWrapper;
+            
+            m_results.push_back(result);
+            
+            m_iNumBusy--;
+        }
+        
+        m_idle.notify_all();
+    }
+}
@@ -0,0 +1,75 @@
+//
+//  TextureLoadingThreadPool.h
+//  noctisgames-framework
+//
+
+#ifndef __noctisgames__TextureLoadingThreadPool__
+#define __noctisgames__TextureLoadingThreadPool__
+
+#include <vector>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#define TEXTURE_LOADING_PRIORITY_NORMAL 0
+#define TEXTURE_LOADING_PRIORITY_ON_SCREEN 1
+
+#define MAX_NUM_TEXTURE_LOADING_THREADS 3
+
+class ITextureLoader;
+class TextureWrapper;
+struct GpuTextureDataWrapper;
+
+struct TextureLoadingRequest
+{
+    TextureWrapper* textureWrapper;
+    std::string name;
+    int priority;
+    unsigned int sequence;
+};
+
+struct TextureLoadingResult
+{
+    TextureWrapper* textureWrapper;
+    std::string name;
+    GpuTextureDataWrapper* gpuTextureDataWrapper;
+};
+
+class TextureLoadingThreadPool
+{
+public:
+    TextureLoadingThreadPool(ITextureLoader* textureLoader);
+    
+    ~TextureLoadingThreadPool();
+    
+    void enqueue(TextureWrapper* textureWrapper, int priority);
+    
+    void prioritize(TextureWrapper* textureWrapper, int priority);
+    
+    void cancel(TextureWrapper* textureWrapper);
+    
+    void cancelAll();
+    
+    void waitUntilIdle();
+    
+    void takeResults(std::vector<TextureLoadingResult>& results);
+
+private:
+    ITextureLoader* m_textureLoader;
+    std::vector<std::thread *> m_threads;
+    std::vector<TextureLoadingRequest> m_pending;
+    std::vector<TextureLoadingResult> m_results;
+    std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    std::condition_variable m_idle;
+    unsigned int m_iSequence;
+    int m_iNumBusy;
+    bool m_isShuttingDown;
+    
+    void startThreads();
+    
+    void workerLoop();
+};
+
+#endif /* defined(__noctisgames__TextureLoadingThreadPool__) */
@@ -10,7 +10,48 @@
 
 #include "TextureRegion.h"
 
-TextureRegion::TextureRegion(std::string textureName, int x, int y, int regionWidth, int regionHeight, int textureWidth, int textureHeight) : m_textureName(textureName)
+#include <vector>
+#include <assert.h>
+
+static std::vector<std::string>& getTextureNames()
+{
+    static std::vector<std::string> textureNames;
+    
+    return textureNames;
+}
+
+int TextureRegion::internTextureName(std::string textureName)
+{
+    std::vector<std::string>& textureNames = getTextureNames();
+    
+    for (int i = 0; i < textureNames.size(); ++i)
+    {
+        if (textureNames[i] == textureName)
+        {
+            return i;
+        }
+    }
+    
+    textureNames.push_back(textureName);
+    
+    return (int) textureNames.size() - 1;
+}
+
+std::string& TextureRegion::getTextureName(int textureId)
+{
+    std::vector<std::string>& textureNames = getTextureNames();
+    
+    assert(textureId >= 0 && textureId < textureNames.size());
+    
+    return textureNames[textureId];
+}
+
+TextureRegion::TextureRegion(std::string textureName, int x, int y, int regionWidth, int regionHeight, int textureWidth, int textureHeight) : m_iTextureId(internTextureName(textureName))
+{
+    init(x, y, regionWidth, regionHeight, textureWidth, textureHeight);
+}
+
+TextureRegion::TextureRegion(int textureId, int x, int y, int regionWidth, int regionHeight, int textureWidth, int textureHeight) : m_iTextureId(textureId)
 {
     init(x, y, regionWidth, regionHeight, textureWidth, textureHeight);
 }
@@ -14,19 +14,27 @@
 class TextureRegion
 {
 public:
+    static int internTextureName(std::string textureName);
+    
+    static std::string& getTextureName(int textureId);
+    
     TextureRegion(std::string textureName, int x, int y, int regionWidth, int regionHeight, int textureWidth, int textureHeight);
     
+    TextureRegion(int textureId, int x, int y, int regionWidth, int regionHeight, int textureWidth, int textureHeight);
+    
     void init(int x, int y, int regionWidth, int regionHeight, int textureWidth, int textureHeight);
     
     void init(int x, int regionWidth, int textureWidth);
     
-    std::string& getTextureName() { return m_textureName; }
+    std::string& getTextureName() { return getTextureName(m_iTextureId); }
+    
+    int getTextureId() { return m_iTextureId; }
     
 	float u1, v1, u2, v2;
     float m_fX, m_fY, m_fRegionWidth, m_fRegionHeight, m_fTextureWidth, m_fTextureHeight;
     
 private:
-    std::string m_textureName;
+    int m_iTextureId;
 };
 
 #endif /* defined(__noctisgames__TextureRegion__) */
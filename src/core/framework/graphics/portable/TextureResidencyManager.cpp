@@ -0,0 +1,138 @@
+//
+//  TextureResidencyManager.cpp
+//  noctisgames-framework
+//
+
+#include "pch.h"
+
+#include "TextureResidencyManager.h"
+
+#include "TextureWrapper.h"
+#include "FlagUtil.h"
+
+#include <algorithm>
+#include <assert.h>
+
+static bool compareLastUsedFrames(TextureWrapper* a, TextureWrapper* b)
+{
+    return a->lastUsedFrame < b->lastUsedFrame;
+}
+
+TextureResidencyManager::TextureResidencyManager() : m_iFrame(0), m_iBudgetBytes(DEFAULT_TEXTURE_MEMORY_BUDGET_BYTES)
+{
+    // Empty
+}
+
+void TextureResidencyManager::acquire(TextureWrapper* textureWrapper, int owner)
+{
+    assert(textureWrapper != nullptr);
+    assert(owner >= 0 && owner < MAX_NUM_TEXTURE_OWNERS);
+    
+    if (std::find(m_textureWrappers.begin(), m_textureWrappers.end(), textureWrapper) == m_textureWrappers.end())
+    {
+        m_textureWrappers.push_back(textureWrapper);
+    }
+    
+    textureWrapper->residencyOwnerFlags = FlagUtil::setFlag(textureWrapper->residencyOwnerFlags, 1 << owner);
+    
+    touch(textureWrapper);
+}
+
+void TextureResidencyManager::release(TextureWrapper* textureWrapper, int owner)
+{
+    assert(textureWrapper != nullptr);
+    assert(owner >= 0 && owner < MAX_NUM_TEXTURE_OWNERS);
+    
+    textureWrapper->residencyOwnerFlags = FlagUtil::removeFlag(textureWrapper->residencyOwnerFlags, 1 << owner);
+    
+    touch(textureWrapper);
+}
+
+void TextureResidencyManager::touch(TextureWrapper* textureWrapper)
+{
+    textureWrapper->lastUsedFrame = m_iFrame;
+}
+
+void TextureResidencyManager::update()
+{
+    m_iFrame++;
+}
+
+void TextureResidencyManager::calcEvictions(std::vector<TextureWrapper *>& evictions)
+{
+    int residentBytes = getResidentBytes();
+    if (residentBytes <= m_iBudgetBytes)
+    {
+        return;
+    }
+    
+    m_evictionCandidates.clear();
+    
+    for (std::vector<TextureWrapper *>::iterator i = m_textureWrappers.begin(); i != m_textureWrappers.end(); ++i)
+    {
+        TextureWrapper* tw = (*i);
+        
+        // Anything owned by a renderer type or drawn this frame stays put
+        if (tw->gpuTextureWrapper
+            && tw->residencyOwnerFlags == 0
+            && tw->lastUsedFrame != m_iFrame)
+        {
+            m_evictionCandidates.push_back(tw);
+        }
+    }
+    
+    std::sort(m_evictionCandidates.begin(), m_evictionCandidates.end(), compareLastUsedFrames);
+    
+    for (std::vector<TextureWrapper *>::iterator i = m_evictionCandidates.begin(); i != m_evictionCandidates.end() && residentBytes > m_iBudgetBytes; ++i)
+    {
+        evictions.push_back((*i));
+        
+        residentBytes -= (*i)->gpuMemorySize;
+    }
+}
+
+void TextureResidencyManager::setBudget(int budgetBytes)
+{
+    m_iBudgetBytes = budgetBytes;
+}
+
+int TextureResidencyManager::getBudget()
+{
+    return m_iBudgetBytes;
+}
+
+int TextureResidencyManager::getResidentBytes()
+{
+    int ret = 0;
+    
+    for (std::vector<TextureWrapper *>::iterator i = m_textureWrappers.begin(); i != m_textureWrappers.end(); ++i)
+    {
+        if ((*i)->gpuTextureWrapper)
+        {
+            ret += (*i)->gpuMemorySize;
+        }
+    }
+    
+    return ret;
+}
+
+int TextureResidencyManager::getReferencedBytes()
+{
+    int ret = 0;
+    
+    for (std::vector<TextureWrapper *>::iterator i = m_textureWrappers.begin(); i != m_textureWrappers.end(); ++i)
+    {
+        if ((*i)->gpuTextureWrapper
+            && (*i)->residencyOwnerFlags != 0)
+        {
+            ret += (*i)->gpuMemorySize;
+        }
+    }
+    
+    return ret;
+}
+
+bool TextureResidencyManager::isOverBudget()
+{
+    return getResidentBytes() > m_iBudgetBytes;
+}
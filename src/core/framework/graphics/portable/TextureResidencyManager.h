@@ -0,0 +1,49 @@
+//
+//  TextureResidencyManager.h
+//  noctisgames-framework
+//
+
+#ifndef __noctisgames__TextureResidencyManager__
+#define __noctisgames__TextureResidencyManager__
+
+#include <vector>
+
+#define DEFAULT_TEXTURE_MEMORY_BUDGET_BYTES 134217728
+
+#define MAX_NUM_TEXTURE_OWNERS 31
+
+class TextureWrapper;
+
+class TextureResidencyManager
+{
+public:
+    TextureResidencyManager();
+    
+    void acquire(TextureWrapper* textureWrapper, int owner);
+    
+    void release(TextureWrapper* textureWrapper, int owner);
+    
+    void touch(TextureWrapper* textureWrapper);
+    
+    void update();
+    
+    void calcEvictions(std::vector<TextureWrapper *>& evictions);
+    
+    void setBudget(int budgetBytes);
+    
+    int getBudget();
+    
+    int getResidentBytes();
+    
+    int getReferencedBytes();
+    
+    bool isOverBudget();
+
+private:
+    std::vector<TextureWrapper *> m_textureWrappers;
+    std::vector<TextureWrapper *> m_evictionCandidates;
+    unsigned int m_iFrame;
+    int m_iBudgetBytes;
+};
+
+#endif /* defined(__noctisgames__TextureResidencyManager__) */
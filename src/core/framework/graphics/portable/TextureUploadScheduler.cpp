@@ -0,0 +1,225 @@
+//
+//  TextureUploadScheduler.cpp
+//  noctisgames-framework
+//
+
+#include "pch.h"
+
+#include "TextureUploadScheduler.h"
+
+#include "ITextureLoader.h"
+#include "IRendererHelper.h"
+#include "TextureWrapper.h"
+#include "GpuTextureDataWrapper.h"
+#include "GpuTextureWrapper.h"
+
+#include <chrono>
+#include <algorithm>
+#include <assert.h>
+
+TextureUploadScheduler::TextureUploadScheduler(ITextureLoader* textureLoader, IRendererHelper* rendererHelper) :
+m_textureLoader(textureLoader),
+m_rendererHelper(rendererHelper),
+m_fBudgetMs(DEFAULT_TEXTURE_UPLOAD_BUDGET_MS),
+m_iBudgetBytes(DEFAULT_TEXTURE_UPLOAD_BUDGET_BYTES),
+m_iNumRowsPerChunk(DEFAULT_TEXTURE_UPLOAD_ROWS_PER_CHUNK),
+m_iNumBytesUploadedLastFrame(0),
+m_iNumBytesDeferred(0),
+m_iNumDeferredFrames(0)
+{
+    assert(m_textureLoader != nullptr);
+    assert(m_rendererHelper != nullptr);
+}
+
+TextureUploadScheduler::~TextureUploadScheduler()
+{
+    cancelAll();
+}
+
+void TextureUploadScheduler::enqueue(TextureWrapper* textureWrapper, GpuTextureDataWrapper* gpuTextureDataWrapper)
+{
+    assert(textureWrapper != nullptr);
+    assert(gpuTextureDataWrapper != nullptr);
+    
+    TextureUpload upload;
+    upload.textureWrapper = textureWrapper;
+    upload.gpuTextureDataWrapper = gpuTextureDataWrapper;
+    upload.gpuTextureWrapper = nullptr;
+    upload.numRows = m_iNumRowsPerChunk > 0 ? m_textureLoader->getTextureDataNumRows(gpuTextureDataWrapper) : 0;
+    upload.numRowsUploaded = 0;
+    upload.numBytes = m_textureLoader->getTextureDataSize(gpuTextureDataWrapper);
+    
+    m_uploads.push_back(upload);
+    
+    calcNumBytesDeferred();
+}
+
+void TextureUploadScheduler::update(std::vector<TextureUpload>& completedUploads)
+{
+    m_iNumBytesUploadedLastFrame = 0;
+    
+    if (m_uploads.size() == 0)
+    {
+        return;
+    }
+    
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    
+    while (m_uploads.size() > 0)
+    {
+        // Always make some progress, otherwise stop as soon as either budget is spent
+        if (m_iNumBytesUploadedLastFrame > 0)
+        {
+            float elapsedMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+            
+            if (elapsedMs >= m_fBudgetMs
+                || m_iNumBytesUploadedLastFrame >= m_iBudgetBytes)
+            {
+                break;
+            }
+        }
+        
+        TextureUpload& upload = m_uploads.front();
+        
+        if (upload.numRows > 0)
+        {
+            if (upload.gpuTextureWrapper == nullptr)
+            {
+                upload.gpuTextureWrapper = m_textureLoader->createTextureStorage(upload.gpuTextureDataWrapper, upload.textureWrapper->repeatS);
+            }
+            
+            int numRows = std::min(m_iNumRowsPerChunk, upload.numRows - upload.numRowsUploaded);
+            
+            m_textureLoader->loadTextureRows(upload.gpuTextureWrapper, upload.gpuTextureDataWrapper, upload.numRowsUploaded, numRows);
+            
+            upload.numRowsUploaded += numRows;
+            m_iNumBytesUploadedLastFrame += (int) ((long long) upload.numBytes * numRows / upload.numRows);
+            
+            if (upload.numRowsUploaded < upload.numRows)
+            {
+                continue;
+            }
+            
+            m_textureLoader->releaseTextureData(upload.gpuTextureDataWrapper);
+        }
+        else
+        {
+            // loadTexture releases the decoded pixels itself
+            upload.gpuTextureWrapper = m_textureLoader->loadTexture(upload.gpuTextureDataWrapper, upload.textureWrapper->repeatS);
+            
+            m_iNumBytesUploadedLastFrame += std::max(upload.numBytes, 1);
+        }
+        
+        delete upload.gpuTextureDataWrapper;
+        upload.gpuTextureDataWrapper = nullptr;
+        
+        completedUploads.push_back(upload);
+        
+        m_uploads.pop_front();
+    }
+    
+    calcNumBytesDeferred();
+    
+    if (m_uploads.size() > 0)
+    {
+        m_iNumDeferredFrames++;
+    }
+}
+
+void TextureUploadScheduler::cancel(TextureWrapper* textureWrapper)
+{
+    for (std::deque<TextureUpload>::iterator i = m_uploads.begin(); i != m_uploads.end(); )
+    {
+        if ((*i).textureWrapper == textureWrapper)
+        {
+            release((*i));
+            
+            i = m_uploads.erase(i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    
+    calcNumBytesDeferred();
+}
+
+void TextureUploadScheduler::cancelAll()
+{
+    for (std::deque<TextureUpload>::iterator i = m_uploads.begin(); i != m_uploads.end(); ++i)
+    {
+        release((*i));
+    }
+    
+    m_uploads.clear();
+    
+    calcNumBytesDeferred();
+}
+
+void TextureUploadScheduler::setBudget(float budgetMs, int budgetBytes)
+{
+    m_fBudgetMs = budgetMs;
+    m_iBudgetBytes = budgetBytes;
+}
+
+void TextureUploadScheduler::setNumRowsPerChunk(int numRowsPerChunk)
+{
+    // 0 uploads every texture in one go
+    m_iNumRowsPerChunk = numRowsPerChunk;
+}
+
+bool TextureUploadScheduler::isUploading()
+{
+    return m_uploads.size() > 0;
+}
+
+int TextureUploadScheduler::getNumBytesUploadedLastFrame()
+{
+    return m_iNumBytesUploadedLastFrame;
+}
+
+int TextureUploadScheduler::getNumBytesDeferred()
+{
+    return m_iNumBytesDeferred;
+}
+
+int TextureUploadScheduler::getNumDeferredFrames()
+{
+    return m_iNumDeferredFrames;
+}
+
+#pragma mark private
+
+void TextureUploadScheduler::release(TextureUpload& upload)
+{
+    if (upload.gpuTextureWrapper)
+    {
+        m_rendererHelper->destroyTexture(*upload.gpuTextureWrapper);
+        
+        delete upload.gpuTextureWrapper;
+        upload.gpuTextureWrapper = nullptr;
+    }
+    
+    m_textureLoader->releaseTextureData(upload.gpuTextureDataWrapper);
+    
+    delete upload.gpuTextureDataWrapper;
+    upload.gpuTextureDataWrapper = nullptr;
+}
+
+void TextureUploadScheduler::calcNumBytesDeferred()
+{
+    m_iNumBytesDeferred = 0;
+    
+    for (std::deque<TextureUpload>::iterator i = m_uploads.begin(); i != m_uploads.end(); ++i)
+    {
+        int numBytes = (*i).numBytes;
+        
+        if ((*i).numRows > 0)
+        {
+            numBytes -= (int) ((long long) (*i).numBytes * (*i).numRowsUploaded / (*i).numRows);
+        }
+        
+        m_iNumBytesDeferred += numBytes;
+    }
+}
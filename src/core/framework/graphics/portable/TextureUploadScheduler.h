@@ -0,0 +1,75 @@
+//
+//  TextureUploadScheduler.h
+//  noctisgames-framework
+//
+
+#ifndef __noctisgames__TextureUploadScheduler__
+#define __noctisgames__TextureUploadScheduler__
+
+#include <deque>
+#include <vector>
+
+#define DEFAULT_TEXTURE_UPLOAD_BUDGET_MS 4.0f
+#define DEFAULT_TEXTURE_UPLOAD_BUDGET_BYTES 4194304
+#define DEFAULT_TEXTURE_UPLOAD_ROWS_PER_CHUNK 128
+
+class ITextureLoader;
+class IRendererHelper;
+class TextureWrapper;
+struct GpuTextureDataWrapper;
+struct GpuTextureWrapper;
+
+struct TextureUpload
+{
+    TextureWrapper* textureWrapper;
+    GpuTextureDataWrapper* gpuTextureDataWrapper;
+    GpuTextureWrapper* gpuTextureWrapper;
+    int numRows;
+    int numRowsUploaded;
+    int numBytes;
+};
+
+class TextureUploadScheduler
+{
+public:
+    TextureUploadScheduler(ITextureLoader* textureLoader, IRendererHelper* rendererHelper);
+    
+    ~TextureUploadScheduler();
+    
+    void enqueue(TextureWrapper* textureWrapper, GpuTextureDataWrapper* gpuTextureDataWrapper);
+    
+    void update(std::vector<TextureUpload>& completedUploads);
+    
+    void cancel(TextureWrapper* textureWrapper);
+    
+    void cancelAll();
+    
+    void setBudget(float budgetMs, int budgetBytes);
+    
+    void setNumRowsPerChunk(int numRowsPerChunk);
+    
+    bool isUploading();
+    
+    int getNumBytesUploadedLastFrame();
+    
+    int getNumBytesDeferred();
+    
+    int getNumDeferredFrames();
+
+private:
+    ITextureLoader* m_textureLoader;
+    IRendererHelper* m_rendererHelper;
+    std::deque<TextureUpload> m_uploads;
+    float m_fBudgetMs;
+    int m_iBudgetBytes;
+    int m_iNumRowsPerChunk;
+    int m_iNumBytesUploadedLastFrame;
+    int m_iNumBytesDeferred;
+    int m_iNumDeferredFrames;
+    
+    void release(TextureUpload& upload);
+    
+    void calcNumBytesDeferred();
+};
+
+#endif /* defined(__noctisgames__TextureUploadScheduler__) */
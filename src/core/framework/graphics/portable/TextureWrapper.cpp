@@ -13,7 +13,7 @@
 #include "GpuTextureDataWrapper.h"
 #include "GpuTextureWrapper.h"
 
-TextureWrapper::TextureWrapper(std::string inName, bool in_repeatS) : name(inName), gpuTextureDataWrapper(nullptr), gpuTextureWrapper(nullptr), repeatS(in_repeatS), isLoadingData(false)
+TextureWrapper::TextureWrapper(std::string inName, bool in_repeatS) : name(inName), gpuTextureDataWrapper(nullptr), gpuTextureWrapper(nullptr), gpuMemorySize(0), decryptTime(0), decodeTime(0), residencyOwnerFlags(0), lastUsedFrame(0), repeatS(in_repeatS), isLoadingData(false)
 {
     // Empty
 }
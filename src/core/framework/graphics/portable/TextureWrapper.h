@@ -20,6 +20,11 @@ public:
     std::string name;
     GpuTextureDataWrapper* gpuTextureDataWrapper;
     GpuTextureWrapper* gpuTextureWrapper;
+    int gpuMemorySize;
+    float decryptTime; // ms, measured when the data was last loaded
+    float decodeTime; // ms, not counting decryptTime
+    int residencyOwnerFlags;
+    unsigned int lastUsedFrame;
     bool repeatS;
     bool isLoadingData;
     
@@ -10,12 +10,32 @@
 
 #include "NGRect.h"
 
+#include "ArenaAllocator.h"
+#include "macros.h"
+
+#include <math.h>
+
+void* NGRect::operator new(size_t size)
+{
+    return ArenaAllocator::allocate(size);
+}
+
+void NGRect::operator delete(void* p)
+{
+    ArenaAllocator::deallocate(p);
+}
+
 NGRect::NGRect(float x, float y, float width, float height, float angle)
 {
     m_lowerLeft = Vector2D(x, y);
     m_fWidth = width;
     m_fHeight = height;
     m_fAngle = angle;
+    
+    // Exact for an unrotated rect, anything else is filled in the first time it is asked for
+    m_fCachedAngle = 0;
+    m_fAngleCos = 1;
+    m_fAngleSin = 0;
 }
 
 Vector2D& NGRect::getLowerLeft()
@@ -72,3 +92,34 @@ void NGRect::setAngle(float angle)
 {
     m_fAngle = angle;
 }
+
+float NGRect::getAngleCos()
+{
+    if (m_fAngle != m_fCachedAngle)
+    {
+        updateAngleCache();
+    }
+    
+    return m_fAngleCos;
+}
+
+float NGRect::getAngleSin()
+{
+    if (m_fAngle != m_fCachedAngle)
+    {
+        updateAngleCache();
+    }
+    
+    return m_fAngleSin;
+}
+
+#pragma mark private
+
+void NGRect::updateAngleCache()
+{
+    float rad = DEGREES_TO_RADIANS(m_fAngle);
+    
+    m_fAngleCos = cosf(rad);
+    m_fAngleSin = sinf(rad);
+    m_fCachedAngle = m_fAngle;
+}
@@ -11,9 +11,16 @@
 
 #include "Vector2D.h"
 
+#include <stddef.h>
+
 class NGRect
 {
 public:
+    // Entity bounds share their entity's ArenaAllocator
+    static void* operator new(size_t size);
+    
+    static void operator delete(void* p);
+    
     NGRect(float x, float y, float width, float height, float angle = 0);
     
     Vector2D& getLowerLeft();
@@ -38,11 +45,21 @@ public:
     
     void setAngle(float angle);
     
+    // cosf and sinf of the angle, only recomputed after the angle changes
+    float getAngleCos();
+    
+    float getAngleSin();
+    
 private:
     Vector2D m_lowerLeft;
     float m_fWidth;
     float m_fHeight;
     float m_fAngle;
+    float m_fCachedAngle;
+    float m_fAngleCos;
+    float m_fAngleSin;
+    
+    void updateAngleCache();
 };
 
 #endif /* defined(__noctisgames__NGRect__) */
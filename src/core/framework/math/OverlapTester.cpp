@@ -21,6 +21,14 @@
 #include <stdlib.h>
 #include <math.h>
 
+#if defined __SSE2__ || defined _M_X64
+#include <emmintrin.h>
+#define NG_OVERLAP_SSE2
+#elif defined __ARM_NEON || defined __ARM_NEON__
+#include <arm_neon.h>
+#define NG_OVERLAP_NEON
+#endif
+
 bool OverlapTester::doCirclesOverlap(Circle &c1, Circle &c2)
 {
     Vector2D c1Center = c1.getCenter();
@@ -38,9 +46,8 @@ bool OverlapTester::doNGRectsOverlap(NGRect &r1, NGRect &r2)
         float halfWidth = r1.getWidth() / 2;
         float halfHeight = r1.getHeight() / 2;
         
-        float rad = DEGREES_TO_RADIANS(r1.getAngle());
-        float cos = cosf(rad);
-        float sin = sinf(rad);
+        float cos = r1.getAngleCos();
+        float sin = r1.getAngleSin();
         
         float x1 = -halfWidth * cos - (-halfHeight) * sin;
         float y1 = -halfWidth * sin + (-halfHeight) * cos;
@@ -77,6 +84,59 @@ bool OverlapTester::doNGRectsOverlap(NGRect &r1, NGRect &r2)
     }
 }
 
+int OverlapTester::calcAABBOverlapMask(float left, float bottom, float right, float top, const float* lefts, const float* bottoms, const float* rights, const float* tops, int count, unsigned char* mask)
+{
+    int numHits = 0;
+    int i = 0;
+    
+#if defined NG_OVERLAP_SSE2
+    __m128 l = _mm_set1_ps(left);
+    __m128 b = _mm_set1_ps(bottom);
+    __m128 r = _mm_set1_ps(right);
+    __m128 t = _mm_set1_ps(top);
+    
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 horizontal = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(lefts + i), r), _mm_cmpge_ps(_mm_loadu_ps(rights + i), l));
+        __m128 vertical = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(bottoms + i), t), _mm_cmpge_ps(_mm_loadu_ps(tops + i), b));
+        int bits = _mm_movemask_ps(_mm_and_ps(horizontal, vertical));
+        
+        for (int j = 0; j < 4; ++j)
+        {
+            mask[i + j] = (bits >> j) & 1;
+            numHits += mask[i + j];
+        }
+    }
+#elif defined NG_OVERLAP_NEON
+    float32x4_t l = vdupq_n_f32(left);
+    float32x4_t b = vdupq_n_f32(bottom);
+    float32x4_t r = vdupq_n_f32(right);
+    float32x4_t t = vdupq_n_f32(top);
+    
+    for (; i + 4 <= count; i += 4)
+    {
+        uint32x4_t horizontal = vandq_u32(vcleq_f32(vld1q_f32(lefts + i), r), vcgeq_f32(vld1q_f32(rights + i), l));
+        uint32x4_t vertical = vandq_u32(vcleq_f32(vld1q_f32(bottoms + i), t), vcgeq_f32(vld1q_f32(tops + i), b));
+        uint32_t lanes[4];
+        vst1q_u32(lanes, vandq_u32(horizontal, vertical));
+        
+        for (int j = 0; j < 4; ++j)
+        {
+            mask[i + j] = lanes[j] & 1;
+            numHits += mask[i + j];
+        }
+    }
+#endif
+    
+    for (; i < count; ++i)
+    {
+        mask[i] = lefts[i] <= right && rights[i] >= left && bottoms[i] <= top && tops[i] >= bottom;
+        numHits += mask[i];
+    }
+    
+    return numHits;
+}
+
 bool OverlapTester::overlapCircleNGRect(Circle &c, NGRect &r)
 {
     float closestX = c.getCenter().getX();
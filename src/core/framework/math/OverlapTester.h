@@ -22,6 +22,10 @@ public:
     
     static bool doNGRectsOverlap(NGRect &r1, NGRect &r2);
     
+    // Tests one box against count boxes stored as separate edge arrays, touching edges count as overlapping.
+    // mask[i] is set to 1 for every hit, and the number of hits is returned.
+    static int calcAABBOverlapMask(float left, float bottom, float right, float top, const float* lefts, const float* bottoms, const float* rights, const float* tops, int count, unsigned char* mask);
+    
     static bool doesNGRectOverlapTriangle(NGRect &r, Triangle &t);
     
     static bool overlapCircleNGRect(Circle &c, NGRect &r);
@@ -0,0 +1,56 @@
+//
+//  NullAudioEngineHelper.cpp
+//  noctisgames-framework
+//
+
+#include "pch.h"
+
+#include "NullAudioEngineHelper.h"
+
+#include "ISoundWrapper.h"
+
+#include <assert.h>
+
+NullAudioEngineHelper* NullAudioEngineHelper::getInstance()
+{
+    static NullAudioEngineHelper instance = NullAudioEngineHelper();
+    return &instance;
+}
+
+void NullAudioEngineHelper::update(int flags)
+{
+    // Empty
+}
+
+void NullAudioEngineHelper::pause()
+{
+    // Empty
+}
+
+void NullAudioEngineHelper::resume()
+{
+    // Empty
+}
+
+ISoundWrapper* NullAudioEngineHelper::loadSound(int soundId, const char *path, int numInstances)
+{
+    // Headless builds run with sound and music disabled, so nothing should ever be loaded
+    assert(false);
+    
+    return nullptr;
+}
+
+ISoundWrapper* NullAudioEngineHelper::loadMusic(const char* path)
+{
+    return loadSound(1337, path);
+}
+
+NullAudioEngineHelper::NullAudioEngineHelper() : IAudioEngineHelper()
+{
+    // Empty
+}
+
+NullAudioEngineHelper::~NullAudioEngineHelper()
+{
+    // Empty
+}
@@ -0,0 +1,36 @@
+//
+//  NullAudioEngineHelper.h
+//  noctisgames-framework
+//
+
+#ifndef __noctisgames__NullAudioEngineHelper__
+#define __noctisgames__NullAudioEngineHelper__
+
+#define NULL_AUDIO_ENGINE_HELPER (NullAudioEngineHelper::getInstance())
+
+#include "IAudioEngineHelper.h"
+
+class NullAudioEngineHelper : public IAudioEngineHelper
+{
+public:
+	static NullAudioEngineHelper* getInstance();
+	
+    virtual void update(int flags = 0);
+    
+    virtual void pause();
+    
+    virtual void resume();
+    
+    virtual ISoundWrapper* loadSound(int soundId, const char *path, int numInstances = 1);
+    
+    virtual ISoundWrapper* loadMusic(const char* path);
+
+private:
+    // ctor, copy ctor, and assignment should be private in a Singleton
+    NullAudioEngineHelper();
+    virtual ~NullAudioEngineHelper();
+    NullAudioEngineHelper(const NullAudioEngineHelper&);
+    NullAudioEngineHelper& operator=(const NullAudioEngineHelper&);
+};
+
+#endif /* defined(__noctisgames__NullAudioEngineHelper__) */
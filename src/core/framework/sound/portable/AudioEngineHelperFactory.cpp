@@ -16,6 +16,8 @@
 #include "AndroidAudioEngineHelper.h"
 #elif defined _WIN32
 #include "WinAudioEngineHelper.h"
+#elif defined __linux__
+#include "NullAudioEngineHelper.h"
 #endif
 
 #include <assert.h>
@@ -34,6 +36,8 @@ IAudioEngineHelper* AudioEngineHelperFactory::createAudioEngineHelper()
     return AndroidAudioEngineHelper::getInstance();
 #elif defined _WIN32
 	return WinAudioEngineHelper::getInstance();
+#elif defined __linux__
+    return NullAudioEngineHelper::getInstance();
 #endif
     
     assert(false);
@@ -0,0 +1,193 @@
+//
+//  NGPackAssets.c
+//  NGPackAssets
+//
+//  Packs asset files into a single archive for PackedAssetArchive:
+//  NGPackAssets assets.ngpak texture_001.ngt texture_002.ngt shader_001_vert.ngs ...
+//  Each file is stored under its file name, without the directory.
+//
+
+#include "../file/opengl/portable/PackedAssetFormat.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    const char* path;
+    const char* name;
+    PackedAssetEntry entry;
+} InputFile;
+
+static const char* file_name(const char* path)
+{
+    const char* slash = strrchr(path, '/');
+    const char* backslash = strrchr(path, '\\');
+    
+    if (backslash > slash)
+    {
+        slash = backslash;
+    }
+    
+    return slash ? slash + 1 : path;
+}
+
+static int is_encrypted(const char* name)
+{
+    const char* dot = strrchr(name, '.');
+    
+    return dot && (strcmp(dot, ".ngt") == 0 || strcmp(dot, ".ngs") == 0);
+}
+
+static int compare_input_files(const void* a, const void* b)
+{
+    uint64_t hash_a = ((const InputFile*) a)->entry.nameHash;
+    uint64_t hash_b = ((const InputFile*) b)->entry.nameHash;
+    
+    return hash_a < hash_b ? -1 : hash_a > hash_b ? 1 : 0;
+}
+
+static uint64_t align(uint64_t offset)
+{
+    return (offset + PACKED_ASSET_ALIGNMENT - 1) / PACKED_ASSET_ALIGNMENT * PACKED_ASSET_ALIGNMENT;
+}
+
+static int copy_file(FILE* input_file, FILE* output_file, uint64_t size)
+{
+    char buffer[64 * 1024];
+    
+    while (size > 0)
+    {
+        size_t chunk = size < sizeof(buffer) ? (size_t) size : sizeof(buffer);
+        
+        if (fread(buffer, 1, chunk, input_file) != chunk
+            || fwrite(buffer, 1, chunk, output_file) != chunk)
+        {
+            return -1;
+        }
+        
+        size -= chunk;
+    }
+    
+    return 0;
+}
+
+static FILE* open_file(const char* path, const char* mode)
+{
+    FILE* file;
+#ifdef _WIN32
+    if (fopen_s(&file, path, mode) != 0)
+    {
+        return NULL;
+    }
+#else
+    file = fopen(path, mode);
+#endif
+    
+    return file;
+}
+
+int main(int argc, const char * argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s <archive> <file>...\n", argv[0]);
+        
+        return -1;
+    }
+    
+    int num_files = argc - 2;
+    InputFile* files = (InputFile*) calloc(num_files, sizeof(InputFile));
+    
+    for (int i = 0; i < num_files; ++i)
+    {
+        FILE* input_file = open_file(argv[i + 2], "rb");
+        if (input_file == NULL)
+        {
+            fprintf(stderr, "can't open %s\n", argv[i + 2]);
+            
+            return -1;
+        }
+        
+        fseek(input_file, 0, SEEK_END);
+        long size = ftell(input_file);
+        fclose(input_file);
+        
+        files[i].path = argv[i + 2];
+        files[i].name = file_name(argv[i + 2]);
+        files[i].entry.nameHash = packedAssetNameHash(files[i].name);
+        files[i].entry.size = (uint64_t) size;
+        files[i].entry.flags = is_encrypted(files[i].name) ? PACKED_ASSET_FLAG_ENCRYPTED : 0;
+    }
+    
+    qsort(files, num_files, sizeof(InputFile), compare_input_files);
+    
+    // The reader binary searches on the hash alone, so two names may never share one
+    for (int i = 1; i < num_files; ++i)
+    {
+        if (files[i - 1].entry.nameHash == files[i].entry.nameHash)
+        {
+            fprintf(stderr, "%s and %s have the same name hash\n", files[i - 1].path, files[i].path);
+            
+            return -1;
+        }
+    }
+    
+    uint64_t offset = align(sizeof(PackedAssetHeader) + num_files * sizeof(PackedAssetEntry));
+    for (int i = 0; i < num_files; ++i)
+    {
+        files[i].entry.offset = offset;
+        offset = align(offset + files[i].entry.size);
+    }
+    
+    FILE* output_file = open_file(argv[1], "w+b");
+    if (output_file == NULL)
+    {
+        fprintf(stderr, "can't create %s\n", argv[1]);
+        
+        return -1;
+    }
+    
+    PackedAssetHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, PACKED_ASSET_MAGIC, 4);
+    header.version = PACKED_ASSET_VERSION;
+    header.numEntries = (uint32_t) num_files;
+    
+    fwrite(&header, sizeof(header), 1, output_file);
+    
+    for (int i = 0; i < num_files; ++i)
+    {
+        fwrite(&files[i].entry, sizeof(PackedAssetEntry), 1, output_file);
+    }
+    
+    for (int i = 0; i < num_files; ++i)
+    {
+        FILE* input_file = open_file(files[i].path, "rb");
+        
+        // Zero padding up to the asset's aligned offset
+        while ((uint64_t) ftell(output_file) < files[i].entry.offset)
+        {
+            fputc(0, output_file);
+        }
+        
+        if (input_file == NULL
+            || copy_file(input_file, output_file, files[i].entry.size) != 0)
+        {
+            fprintf(stderr, "can't read %s\n", files[i].path);
+            
+            return -1;
+        }
+        
+        fclose(input_file);
+    }
+    
+    fclose(output_file);
+    
+    printf("packed %d files into %s\n", num_files, argv[1]);
+    
+    free(files);
+    
+    return 0;
+}
@@ -32,9 +32,9 @@
 #include "TextureLoaderFactory.h"
 #include "RendererHelperFactory.h"
 #include "GpuProgramWrapperFactory.h"
-#include "NGSTDUtil.h"
 
 #include <string>
+#include <algorithm>
 #include <assert.h>
 
 Renderer::Renderer(int maxBatchSize) :
@@ -45,6 +45,9 @@ m_lineBatcher(LINE_BATCHER_FACTORY->createLineBatcher()),
 m_circleBatcher(CIRCLE_BATCHER_FACTORY->createCircleBatcher()),
 m_textureLoader(TEXTURE_LOADER_FACTORY->createTextureLoader()),
 m_rendererHelper(RENDERER_HELPER_FACTORY->createRendererHelper()),
+m_textureLoadingThreadPool(new TextureLoadingThreadPool(m_textureLoader)),
+m_textureUploadScheduler(new TextureUploadScheduler(m_textureLoader, m_rendererHelper)),
+m_textureResidencyManager(new TextureResidencyManager()),
 m_textureGpuProgramWrapper(nullptr),
 m_colorGpuProgramWrapper(nullptr),
 m_framebufferToScreenGpuProgramWrapper(nullptr),
@@ -64,6 +67,10 @@ Renderer::~Renderer()
     delete m_lineBatcher;
     delete m_circleBatcher;
     
+    delete m_textureLoadingThreadPool;
+    delete m_textureUploadScheduler;
+    delete m_textureResidencyManager;
+    
     delete m_textureLoader;
     delete m_rendererHelper;
 }
@@ -88,14 +95,12 @@ void Renderer::createWindowSizeDependentResources(int renderWidth, int renderHei
 
 void Renderer::releaseDeviceDependentResources()
 {
+	discardAsyncTextureLoads();
+
 	m_rendererHelper->releaseDeviceDependentResources();
 
     m_areDeviceDependentResourcesCreated = false;
 	m_areWindowSizeDependentResourcesCreated = false;
-
-	m_loadingTextures.clear();
-
-	cleanUpThreads();
     
     delete m_textureGpuProgramWrapper;
 	m_textureGpuProgramWrapper = nullptr;
@@ -155,6 +160,16 @@ bool Renderer::isReadyForRendering()
 	return m_areDeviceDependentResourcesCreated && m_areWindowSizeDependentResourcesCreated;
 }
 
+TextureUploadScheduler* Renderer::getTextureUploadScheduler()
+{
+    return m_textureUploadScheduler;
+}
+
+TextureResidencyManager* Renderer::getTextureResidencyManager()
+{
+    return m_textureResidencyManager;
+}
+
 #pragma mark protected
 
 void Renderer::renderPhysicalEntity(PhysicalEntity &pe, TextureRegion& tr)
@@ -197,6 +212,9 @@ void Renderer::loadTextureSync(TextureWrapper* textureWrapper)
     
     textureWrapper->isLoadingData = true;
     textureWrapper->gpuTextureDataWrapper = m_textureLoader->loadTextureData(textureWrapper->name.c_str());
+    textureWrapper->gpuMemorySize = m_textureLoader->getTextureDataSize(textureWrapper->gpuTextureDataWrapper);
+    textureWrapper->decryptTime = m_textureLoader->getTextureDataDecryptTime(textureWrapper->gpuTextureDataWrapper);
+    textureWrapper->decodeTime = m_textureLoader->getTextureDataDecodeTime(textureWrapper->gpuTextureDataWrapper);
     
     textureWrapper->gpuTextureWrapper = m_textureLoader->loadTexture(textureWrapper->gpuTextureDataWrapper);
     
@@ -206,7 +224,7 @@ void Renderer::loadTextureSync(TextureWrapper* textureWrapper)
     textureWrapper->isLoadingData = false;
 }
 
-void Renderer::loadTextureAsync(TextureWrapper* textureWrapper)
+void Renderer::loadTextureAsync(TextureWrapper* textureWrapper, int priority)
 {
     assert(textureWrapper != nullptr);
     assert(textureWrapper->name.length() > 0);
@@ -221,13 +239,7 @@ void Renderer::loadTextureAsync(TextureWrapper* textureWrapper)
     m_loadingTextures.push_back(textureWrapper);
     
     textureWrapper->isLoadingData = true;
-    m_textureDataLoadingThreads.push_back(new std::thread([](TextureWrapper* tw, Renderer* r)
-    {
-        if (r->m_areDeviceDependentResourcesCreated)
-        {
-            tw->gpuTextureDataWrapper = r->m_textureLoader->loadTextureData(tw->name.c_str());
-        }
-    }, textureWrapper, this));
+    m_textureLoadingThreadPool->enqueue(textureWrapper, priority);
 }
 
 void Renderer::unloadTexture(TextureWrapper* textureWrapper)
@@ -237,6 +249,9 @@ void Renderer::unloadTexture(TextureWrapper* textureWrapper)
         return;
     }
     
+    m_textureLoadingThreadPool->cancel(textureWrapper);
+    m_textureUploadScheduler->cancel(textureWrapper);
+    
     for (std::vector<TextureWrapper *>::iterator i = m_loadingTextures.begin(); i != m_loadingTextures.end(); )
     {
         if ((*i) == textureWrapper)
@@ -255,6 +270,8 @@ void Renderer::unloadTexture(TextureWrapper* textureWrapper)
         
         delete textureWrapper->gpuTextureWrapper;
         textureWrapper->gpuTextureWrapper = nullptr;
+        
+        textureWrapper->gpuMemorySize = 0;
     }
     
     if (textureWrapper->gpuTextureDataWrapper)
@@ -266,13 +283,32 @@ void Renderer::unloadTexture(TextureWrapper* textureWrapper)
     textureWrapper->isLoadingData = false;
 }
 
+void Renderer::acquireTexture(TextureWrapper* textureWrapper, int owner)
+{
+    m_textureResidencyManager->acquire(textureWrapper, owner);
+    
+    loadTextureAsync(textureWrapper);
+}
+
+void Renderer::releaseTexture(TextureWrapper* textureWrapper, int owner)
+{
+    // Stays resident until the budget needs the memory back, see evictTextures
+    m_textureResidencyManager->release(textureWrapper, owner);
+}
+
 bool Renderer::ensureTexture(TextureWrapper* textureWrapper)
 {
+    m_textureResidencyManager->touch(textureWrapper);
+    
     if (textureWrapper->gpuTextureWrapper == nullptr)
     {
         if (!textureWrapper->isLoadingData)
         {
-            loadTextureAsync(textureWrapper);
+            loadTextureAsync(textureWrapper, TEXTURE_LOADING_PRIORITY_ON_SCREEN);
+        }
+        else
+        {
+            m_textureLoadingThreadPool->prioritize(textureWrapper, TEXTURE_LOADING_PRIORITY_ON_SCREEN);
         }
         
         return false;
@@ -283,37 +319,85 @@ bool Renderer::ensureTexture(TextureWrapper* textureWrapper)
 
 void Renderer::handleAsyncTextureLoads()
 {
-    for (std::vector<TextureWrapper *>::iterator i = m_loadingTextures.begin(); i != m_loadingTextures.end(); )
+    m_textureLoadingThreadPool->takeResults(m_textureLoadingResults);
+    
+    for (std::vector<TextureLoadingResult>::iterator i = m_textureLoadingResults.begin(); i != m_textureLoadingResults.end(); ++i)
     {
-        if ((*i)->gpuTextureDataWrapper)
+        TextureWrapper* tw = (*i).textureWrapper;
+        
+        // Unloaded or renamed while the data was being decoded
+        if (std::find(m_loadingTextures.begin(), m_loadingTextures.end(), tw) == m_loadingTextures.end()
+            || tw->gpuTextureWrapper
+            || tw->name != (*i).name)
         {
-            (*i)->gpuTextureWrapper = m_textureLoader->loadTexture((*i)->gpuTextureDataWrapper, (*i)->repeatS);
+            m_textureLoader->releaseTextureData((*i).gpuTextureDataWrapper);
             
-            delete (*i)->gpuTextureDataWrapper;
-            (*i)->gpuTextureDataWrapper = nullptr;
+            delete (*i).gpuTextureDataWrapper;
             
-            (*i)->isLoadingData = false;
-            
-            i = m_loadingTextures.erase(i);
-        }
-        else
-        {
-            ++i;
+            continue;
         }
+        
+        tw->decryptTime = m_textureLoader->getTextureDataDecryptTime((*i).gpuTextureDataWrapper);
+        tw->decodeTime = m_textureLoader->getTextureDataDecodeTime((*i).gpuTextureDataWrapper);
+        
+        m_textureUploadScheduler->enqueue(tw, (*i).gpuTextureDataWrapper);
     }
     
-    if (m_loadingTextures.size() == 0)
+    m_textureLoadingResults.clear();
+    
+    m_textureUploadScheduler->update(m_completedTextureUploads);
+    
+    for (std::vector<TextureUpload>::iterator i = m_completedTextureUploads.begin(); i != m_completedTextureUploads.end(); ++i)
     {
-        cleanUpThreads();
+        TextureWrapper* tw = (*i).textureWrapper;
+        
+        tw->gpuTextureWrapper = (*i).gpuTextureWrapper;
+        tw->gpuMemorySize = (*i).numBytes;
+        tw->isLoadingData = false;
+        
+        m_loadingTextures.erase(std::remove(m_loadingTextures.begin(), m_loadingTextures.end(), tw), m_loadingTextures.end());
     }
+    
+    m_completedTextureUploads.clear();
+    
+    evictTextures();
+    
+    m_textureResidencyManager->update();
 }
 
-void Renderer::cleanUpThreads()
+void Renderer::discardAsyncTextureLoads()
 {
-    for (std::vector<std::thread *>::iterator i = m_textureDataLoadingThreads.begin(); i != m_textureDataLoadingThreads.end(); ++i)
+    m_textureLoadingThreadPool->cancelAll();
+    m_textureLoadingThreadPool->waitUntilIdle();
+    m_textureLoadingThreadPool->takeResults(m_textureLoadingResults);
+    
+    for (std::vector<TextureLoadingResult>::iterator i = m_textureLoadingResults.begin(); i != m_textureLoadingResults.end(); ++i)
+    {
+        m_textureLoader->releaseTextureData((*i).gpuTextureDataWrapper);
+        
+        delete (*i).gpuTextureDataWrapper;
+    }
+    
+    m_textureLoadingResults.clear();
+    
+    m_textureUploadScheduler->cancelAll();
+    
+    for (std::vector<TextureWrapper *>::iterator i = m_loadingTextures.begin(); i != m_loadingTextures.end(); ++i)
+    {
+        (*i)->isLoadingData = false;
+    }
+    
+    m_loadingTextures.clear();
+}
+
+void Renderer::evictTextures()
+{
+    m_textureResidencyManager->calcEvictions(m_textureEvictions);
+    
+    for (std::vector<TextureWrapper *>::iterator i = m_textureEvictions.begin(); i != m_textureEvictions.end(); ++i)
     {
-        (*i)->join();
+        unloadTexture((*i));
     }
     
-    NGSTDUtil::cleanUpVectorOfPointers(m_textureDataLoadingThreads);
+    m_textureEvictions.clear();
 }
@@ -9,8 +9,11 @@
 #ifndef __noctisgames__Renderer__
 #define __noctisgames__Renderer__
 
+#include "TextureLoadingThreadPool.h"
+#include "TextureUploadScheduler.h"
+#include "TextureResidencyManager.h"
+
 #include <vector>
-#include <thread>
 
 class SpriteBatcher;
 class NGRectBatcher;
@@ -50,6 +53,10 @@ public:
 
 	bool isReadyForRendering();
     
+    TextureUploadScheduler* getTextureUploadScheduler();
+    
+    TextureResidencyManager* getTextureResidencyManager();
+    
 protected:
     SpriteBatcher* m_spriteBatcher;
     NGRectBatcher* m_fillNGRectBatcher;
@@ -78,22 +85,33 @@ protected:
     
     void loadTextureSync(TextureWrapper* textureWrapper);
     
-    void loadTextureAsync(TextureWrapper* textureWrapper);
+    void loadTextureAsync(TextureWrapper* textureWrapper, int priority = TEXTURE_LOADING_PRIORITY_NORMAL);
     
     void unloadTexture(TextureWrapper* textureWrapper);
     
+    void acquireTexture(TextureWrapper* textureWrapper, int owner);
+    
+    void releaseTexture(TextureWrapper* textureWrapper, int owner);
+    
     bool ensureTexture(TextureWrapper* textureWrapper);
     
 private:
+    TextureLoadingThreadPool* m_textureLoadingThreadPool;
+    TextureUploadScheduler* m_textureUploadScheduler;
+    TextureResidencyManager* m_textureResidencyManager;
     std::vector<TextureWrapper *> m_loadingTextures;
-    std::vector<std::thread *> m_textureDataLoadingThreads;
+    std::vector<TextureLoadingResult> m_textureLoadingResults;
+    std::vector<TextureUpload> m_completedTextureUploads;
+    std::vector<TextureWrapper *> m_textureEvictions;
 	int m_iMaxBatchSize;
     bool m_areDeviceDependentResourcesCreated;
 	bool m_areWindowSizeDependentResourcesCreated;
     
     void handleAsyncTextureLoads();
     
-    void cleanUpThreads();
+    void discardAsyncTextureLoads();
+    
+    void evictTextures();
 };
 
 #endif /* defined(__noctisgames__Renderer__) */
@@ -0,0 +1,161 @@
+//
+//  ArenaAllocator.cpp
+//  noctisgames-framework
+//
+
+#include "pch.h"
+
+#include "ArenaAllocator.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+struct ArenaBlockHeader
+{
+    ArenaAllocator* arena;
+    size_t blockSize;
+};
+
+#define ARENA_HEADER_SIZE ((sizeof(ArenaBlockHeader) + ARENA_ALIGNMENT - 1) & ~(size_t) (ARENA_ALIGNMENT - 1))
+
+static thread_local ArenaAllocator* s_currentArena = nullptr;
+
+ArenaAllocator* ArenaAllocator::setCurrent(ArenaAllocator* arena)
+{
+    ArenaAllocator* ret = s_currentArena;
+    
+    s_currentArena = arena;
+    
+    return ret;
+}
+
+void* ArenaAllocator::allocate(size_t size)
+{
+    size_t blockSize = (ARENA_HEADER_SIZE + size + ARENA_ALIGNMENT - 1) & ~(size_t) (ARENA_ALIGNMENT - 1);
+    
+    ArenaAllocator* arena = blockSize <= ARENA_MAX_BLOCK_SIZE ? s_currentArena : nullptr;
+    
+    void* block = arena ? arena->allocateBlock(blockSize) : malloc(blockSize);
+    assert(block != nullptr);
+    
+    ArenaBlockHeader* header = static_cast<ArenaBlockHeader *>(block);
+    header->arena = arena;
+    header->blockSize = blockSize;
+    
+    return static_cast<char *>(block) + ARENA_HEADER_SIZE;
+}
+
+void ArenaAllocator::deallocate(void* p)
+{
+    if (!p)
+    {
+        return;
+    }
+    
+    void* block = static_cast<char *>(p) - ARENA_HEADER_SIZE;
+    
+    ArenaBlockHeader* header = static_cast<ArenaBlockHeader *>(block);
+    if (header->arena)
+    {
+        header->arena->deallocateBlock(block, header->blockSize);
+    }
+    else
+    {
+        free(block);
+    }
+}
+
+ArenaAllocator::ArenaAllocator() : m_cursor(nullptr), m_end(nullptr), m_iNumAllocations(0)
+{
+    memset(m_freeLists, 0, sizeof(m_freeLists));
+}
+
+ArenaAllocator::~ArenaAllocator()
+{
+    // A block outliving its arena would point its header at freed memory
+    assert(m_iNumAllocations == 0);
+    
+    reset();
+}
+
+void ArenaAllocator::reset()
+{
+    // Freeing the chunks now would leave the outstanding blocks dangling, so the owner has to delete them first
+    assert(m_iNumAllocations == 0);
+    
+    if (m_iNumAllocations > 0)
+    {
+        // Release builds keep the chunks and carry on recycling blocks through the free lists
+        return;
+    }
+    
+    for (std::vector<char*>::iterator i = m_chunks.begin(); i != m_chunks.end(); ++i)
+    {
+        free((*i));
+    }
+    
+    m_chunks.clear();
+    
+    memset(m_freeLists, 0, sizeof(m_freeLists));
+    
+    m_cursor = nullptr;
+    m_end = nullptr;
+}
+
+int ArenaAllocator::getNumAllocations()
+{
+    return m_iNumAllocations;
+}
+
+size_t ArenaAllocator::getNumBytesReserved()
+{
+    return m_chunks.size() * ARENA_CHUNK_SIZE;
+}
+
+#pragma mark private
+
+void* ArenaAllocator::allocateBlock(size_t blockSize)
+{
+    int sizeClass = (int) (blockSize / ARENA_ALIGNMENT) - 1;
+    
+    void* ret = m_freeLists[sizeClass];
+    if (ret)
+    {
+        // Freed blocks keep the next pointer of their list where the header was
+        m_freeLists[sizeClass] = *static_cast<void **>(ret);
+    }
+    else
+    {
+        if (m_cursor + blockSize > m_end)
+        {
+            char* chunk = static_cast<char *>(malloc(ARENA_CHUNK_SIZE));
+            if (!chunk)
+            {
+                return nullptr;
+            }
+            
+            m_chunks.push_back(chunk);
+            
+            m_cursor = chunk;
+            m_end = chunk + ARENA_CHUNK_SIZE;
+        }
+        
+        ret = m_cursor;
+        m_cursor += blockSize;
+    }
+    
+    m_iNumAllocations++;
+    
+    return ret;
+}
+
+void ArenaAllocator::deallocateBlock(void* block, size_t blockSize)
+{
+    int sizeClass = (int) (blockSize / ARENA_ALIGNMENT) - 1;
+    
+    *static_cast<void **>(block) = m_freeLists[sizeClass];
+    m_freeLists[sizeClass] = block;
+    
+    m_iNumAllocations--;
+}
@@ -0,0 +1,55 @@
+//
+//  ArenaAllocator.h
+//  noctisgames-framework
+//
+
+#ifndef __noctisgames__ArenaAllocator__
+#define __noctisgames__ArenaAllocator__
+
+#include <stddef.h>
+#include <vector>
+
+#define ARENA_CHUNK_SIZE 65536
+#define ARENA_ALIGNMENT 16
+#define ARENA_MAX_BLOCK_SIZE 4096
+#define ARENA_NUM_SIZE_CLASSES (ARENA_MAX_BLOCK_SIZE / ARENA_ALIGNMENT)
+
+// Blocks come from the arena current on the calling thread, or from the heap when there is none
+class ArenaAllocator
+{
+public:
+    static ArenaAllocator* setCurrent(ArenaAllocator* arena);
+    
+    static void* allocate(size_t size);
+    
+    static void deallocate(void* p);
+    
+    ArenaAllocator();
+    
+    ~ArenaAllocator();
+    
+    // Frees every chunk at once, all blocks must have been handed back by then,
+    // a reset with blocks still out asserts and otherwise keeps the chunks
+    void reset();
+    
+    int getNumAllocations();
+    
+    size_t getNumBytesReserved();
+    
+private:
+    std::vector<char*> m_chunks;
+    void* m_freeLists[ARENA_NUM_SIZE_CLASSES];
+    char* m_cursor;
+    char* m_end;
+    int m_iNumAllocations;
+    
+    void* allocateBlock(size_t blockSize);
+    
+    void deallocateBlock(void* block, size_t blockSize);
+    
+    // Prevent copying
+    ArenaAllocator(const ArenaAllocator&);
+    ArenaAllocator& operator=(const ArenaAllocator&);
+};
+
+#endif /* defined(__noctisgames__ArenaAllocator__) */
@@ -19,23 +19,23 @@ public:
     template<typename T>
     static void cleanUpVectorOfPointers(std::vector<T*>& items)
     {
-        for (typename std::vector<T*>::iterator i = items.begin(); i != items.end(); )
+        for (typename std::vector<T*>::iterator i = items.begin(); i != items.end(); ++i)
         {
             delete *i;
-            
-            i = items.erase(i);
         }
+        
+        items.clear();
     }
     
     template<typename T>
     static void cleanUpVectorOfUniquePointers(std::vector<std::unique_ptr<T>>& items)
     {
-        for (typename std::vector<std::unique_ptr<T>>::iterator i = items.begin(); i != items.end(); )
+        for (typename std::vector<std::unique_ptr<T>>::iterator i = items.begin(); i != items.end(); ++i)
         {
             (*i).reset();
-            
-            i = items.erase(i);
         }
+        
+        items.clear();
     }
     
     template<typename K, typename T>
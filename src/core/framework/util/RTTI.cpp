@@ -10,12 +10,12 @@
 
 #include "RTTI.h"
 
-RTTI::RTTI(const std::string & className) : m_className(className), m_pBaseRTTI(nullptr)
+RTTI::RTTI(const std::string & className) : m_className(className), m_pBaseRTTI(nullptr), m_iTypeTag(0)
 {
     // Empty
 }
 
-RTTI::RTTI(const std::string & className, const RTTI & baseRTTI) : m_className(className), m_pBaseRTTI(&baseRTTI)
+RTTI::RTTI(const std::string & className, const RTTI & baseRTTI, int typeTag) : m_className(className), m_pBaseRTTI(&baseRTTI), m_iTypeTag(typeTag)
 {
     // Empty
 }
@@ -46,3 +46,20 @@ bool RTTI::derivesFrom(const RTTI & rtti) const
     
     return false;
 }
+
+int RTTI::getTypeTags() const
+{
+    // Walked on demand, the base RTTI may live in a translation unit that hasn't been initialized yet
+    int ret = 0;
+    
+    const RTTI * pCompare = this;
+    
+    while (pCompare)
+    {
+        ret |= pCompare->m_iTypeTag;
+        
+        pCompare = pCompare->m_pBaseRTTI;
+    }
+    
+    return ret;
+}
@@ -15,7 +15,7 @@ class RTTI
 {
 public:
     RTTI(const std::string & className);
-    RTTI(const std::string & className, const RTTI & baseRTTI);
+    RTTI(const std::string & className, const RTTI & baseRTTI, int typeTag = 0);
 
     const std::string & getClassName() const;
     
@@ -23,6 +23,9 @@ public:
     
     bool derivesFrom(const RTTI & rtti) const;
 
+    // This class's tag plus those of every class it derives from
+    int getTypeTags() const;
+
 private:
     // Prevent copying
     RTTI(const RTTI & obj);
@@ -30,6 +33,7 @@ private:
 
     const std::string m_className;
     const RTTI *m_pBaseRTTI;
+    const int m_iTypeTag;
 };
 
 #define RTTI_DECL \
@@ -43,4 +47,7 @@ private:
 #define RTTI_IMPL(name,parent) \
     const RTTI name::rtti(#name, parent::rtti);
 
+#define RTTI_IMPL_TAG(name,parent,tag) \
+    const RTTI name::rtti(#name, parent::rtti, tag);
+
 #endif /* defined(__noctisgames__RTTI__) */
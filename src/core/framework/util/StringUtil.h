@@ -11,6 +11,8 @@
 
 #include <string>
 #include <sstream>
+#include <stdint.h>
+#include <string.h>
 
 class StringUtil
 {
@@ -30,11 +32,42 @@ public:
     
     static void encryptDecrypt(unsigned char* input, unsigned char* output, const long dataLength)
     {
-        char key[3] = {'N', 'G', 'S'}; // Any chars will work, in an array of any size
+        encryptDecrypt(input, output, dataLength, 0);
+    }
+    
+    // keyOffset is the position of input[0] in the whole stream, so a stream can be decrypted a chunk at a time.
+    // Works a word at a time, input and output may be the same buffer.
+    static void encryptDecrypt(const unsigned char* input, unsigned char* output, const long dataLength, const long keyOffset)
+    {
+        const unsigned char key[3] = {'N', 'G', 'S'}; // Must match the key above
         
-        for (unsigned int i = 0; i < dataLength; ++i)
+        // 24 bytes is a whole number of both key repeats and words
+        const int keyPhase = (int) (keyOffset % 3);
+        unsigned char pattern[24];
+        for (int i = 0; i < 24; ++i)
         {
-            output[i] = input[i] ^ key[i % (sizeof(key) / sizeof(char))];
+            pattern[i] = key[(i + keyPhase) % 3];
+        }
+        
+        uint64_t patternWords[3];
+        memcpy(patternWords, pattern, sizeof(patternWords));
+        
+        long i = 0;
+        for (; i + 24 <= dataLength; i += 24)
+        {
+            uint64_t words[3];
+            memcpy(words, input + i, sizeof(words));
+            
+            words[0] ^= patternWords[0];
+            words[1] ^= patternWords[1];
+            words[2] ^= patternWords[2];
+            
+            memcpy(output + i, words, sizeof(words));
+        }
+        
+        for (; i < dataLength; ++i)
+        {
+            output[i] = input[i] ^ pattern[i % 24];
         }
     }
     
@@ -23,9 +23,9 @@ void OpenGLFramebufferRadialBlurGpuProgram::bind()
     
     glUniform1i(u_texture_unit_location, 0);
     
-    mapBuffer(OGLManager->getSbVboObject(), OGLManager->getTextureVertices());
+    GLintptr offset = mapBuffer(OGLManager->getSbVboObject(), OGLManager->getTextureVertices());
     
-    glVertexAttribPointer(a_position_location, 2, GL_FLOAT, GL_FALSE, sizeof(GLfloat) * 9, BUFFER_OFFSET(0));
+    glVertexAttribPointer(a_position_location, 2, GL_FLOAT, GL_FALSE, sizeof(GLfloat) * 9, BUFFER_OFFSET(offset));
     
     glEnableVertexAttribArray(a_position_location);
 }
@@ -29,9 +29,9 @@ void OpenGLPointTransitionProgram::bind()
     glUniform1i(u_from_location, 0);
     glUniform1i(u_to_location, 1);
     
-    mapBuffer(OGLManager->getSbVboObject(), OGLManager->getTextureVertices());
+    GLintptr offset = mapBuffer(OGLManager->getSbVboObject(), OGLManager->getTextureVertices());
     
-    glVertexAttribPointer(a_position_location, 2, GL_FLOAT, GL_FALSE, sizeof(GLfloat) * 9, BUFFER_OFFSET(0));
+    glVertexAttribPointer(a_position_location, 2, GL_FLOAT, GL_FALSE, sizeof(GLfloat) * 9, BUFFER_OFFSET(offset));
     
     glEnableVertexAttribArray(a_position_location);
 }
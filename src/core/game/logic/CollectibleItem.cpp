@@ -43,11 +43,7 @@ CollectibleItem::CollectibleItem(int gridX, int gridY, int gridWidth, int gridHe
     
     m_fOriginalY = m_position.getY();
 
-	static float stateTimeSeed = 0;
-
-	m_fStateTime = stateTimeSeed;
-
-	stateTimeSeed += 0.08f;
+	m_fStateTime = nextStateTimeSeed();
     
     resize();
 }
@@ -105,6 +101,27 @@ void CollectibleItem::resize()
     // Override in Subclass
 }
 
+void CollectibleItem::onWake(float elapsed)
+{
+    // The bob is worked out from the state time, so it picks up where it would have been
+    m_fStateTime += elapsed;
+}
+
+void CollectibleItem::resetToSnapshot(int gridX, int gridY)
+{
+    GridLockedPhysicalEntity::resetToSnapshot(gridX, gridY);
+    
+    m_color = Color(1, 1, 1, 1);
+    
+    m_fOriginalY = m_position.getY();
+    
+    // Takes the next seed just like a newly created item would, so the bobbing lines up with a fresh load
+    m_fStateTime = nextStateTimeSeed();
+    
+    m_isCollected = false;
+    m_isOnScreen = false;
+}
+
 void CollectibleItem::collect()
 {
     if (!m_isCollected)
@@ -136,6 +153,19 @@ void CollectibleItem::setGame(Game* game)
     m_game = game;
 }
 
+#pragma mark private
+
+float CollectibleItem::nextStateTimeSeed()
+{
+    static float stateTimeSeed = 0;
+    
+    float ret = stateTimeSeed;
+    
+    stateTimeSeed += 0.08f;
+    
+    return ret;
+}
+
 Carrot::Carrot(int gridX, int gridY) : CollectibleItem(gridX, gridY, 6, 7, SOUND_ID_COLLECT_CARROT, CollectibleItemType_Carrot)
 {
     // Empty
@@ -187,16 +217,16 @@ GoldenCarrotTwinkle::GoldenCarrotTwinkle(float x, float y, float seedStateTime)
     m_fStateTime = seedStateTime;
 }
 
+void GoldenCarrotTwinkle::onWake(float elapsed)
+{
+    m_fStateTime += elapsed;
+}
+
 GoldenCarrot::GoldenCarrot(int gridX, int gridY) : CollectibleItem(gridX, gridY, 6, 8, SOUND_ID_COLLECT_GOLDEN_CARROT, CollectibleItemType_GoldenCarrot), m_iIndex(0), m_isPreviouslyCollected(false)
 {
-    float x = m_position.getX();
-    float y = m_position.getY();
-    float w = m_fWidth;
-    float h = m_fHeight;
-    float l = x - w / 2;
-    float b = y - (h / 2);
+    m_goldenCarrotTwinkle = new GoldenCarrotTwinkle(0, 0, m_fStateTime);
     
-    m_goldenCarrotTwinkle = new GoldenCarrotTwinkle(0.53543307086614f * w + l, 0.60714285714286f * h + b, m_fStateTime);
+    placeTwinkle();
 }
 
 GoldenCarrot::~GoldenCarrot()
@@ -283,6 +313,28 @@ void GoldenCarrot::resize()
     m_fHeight = 1.96875f;
 }
 
+void GoldenCarrot::onWake(float elapsed)
+{
+    CollectibleItem::onWake(elapsed);
+    
+    if (!m_isPreviouslyCollected)
+    {
+        m_goldenCarrotTwinkle->onWake(elapsed);
+    }
+}
+
+void GoldenCarrot::resetToSnapshot(int gridX, int gridY)
+{
+    CollectibleItem::resetToSnapshot(gridX, gridY);
+    
+    m_iIndex = 0;
+    m_isPreviouslyCollected = false;
+    
+    m_goldenCarrotTwinkle->setStateTime(m_fStateTime);
+    
+    placeTwinkle();
+}
+
 void GoldenCarrot::init(int index, int bestLevelStatsFlag)
 {
     m_iIndex = index;
@@ -311,6 +363,21 @@ bool GoldenCarrot::isPreviouslyCollected()
     return m_isPreviouslyCollected;
 }
 
+#pragma mark private
+
+void GoldenCarrot::placeTwinkle()
+{
+    float x = m_position.getX();
+    float y = m_position.getY();
+    float w = m_fWidth;
+    float h = m_fHeight;
+    float l = x - w / 2;
+    float b = y - (h / 2);
+    
+    m_goldenCarrotTwinkle->getPosition().set(0.53543307086614f * w + l, 0.60714285714286f * h + b);
+    m_goldenCarrotTwinkle->updateBounds();
+}
+
 BigCarrot::BigCarrot(int gridX, int gridY) : CollectibleItem(gridX, gridY, 27, 27, SOUND_ID_COLLECT_BIG_CARROT, CollectibleItemType_BigCarrot, 0.405092592592593f, 0.259259259259259f, 0.428240740740741f, 0.481481481481481f)
 {
     // Empty
@@ -33,6 +33,10 @@ public:
     
     virtual void resize();
     
+    virtual void onWake(float elapsed);
+    
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     void collect();
     
     bool isCollected();
@@ -51,6 +55,9 @@ protected:
     int m_iCollectSoundId;
     bool m_isCollected;
     bool m_isOnScreen;
+    
+private:
+    static float nextStateTimeSeed();
 };
 
 class Carrot : public CollectibleItem
@@ -75,6 +82,8 @@ class GoldenCarrotTwinkle : public PhysicalEntity
     
 public:
     GoldenCarrotTwinkle(float x, float y, float seedStateTime);
+    
+    virtual void onWake(float elapsed);
 };
 
 class GoldenCarrot : public CollectibleItem
@@ -94,6 +103,10 @@ public:
     
     virtual void resize();
     
+    virtual void onWake(float elapsed);
+    
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     void init(int index, int bestLevelStatsFlag);
     
     GoldenCarrotTwinkle& getGoldenCarrotTwinkle();
@@ -106,6 +119,8 @@ private:
     GoldenCarrotTwinkle* m_goldenCarrotTwinkle;
     int m_iIndex;
     bool m_isPreviouslyCollected;
+    
+    void placeTwinkle();
 };
 
 class BigCarrot : public CollectibleItem
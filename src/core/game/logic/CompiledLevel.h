@@ -0,0 +1,53 @@
+//
+//  CompiledLevel.h
+//  nosfuratu
+//
+
+#ifndef __nosfuratu__CompiledLevel__
+#define __nosfuratu__CompiledLevel__
+
+#include <stdint.h>
+
+// Written by utils/CompileLevels, all fields are little endian
+#define COMPILED_LEVEL_MAGIC 0x564C474E // NGLV
+#define COMPILED_LEVEL_VERSION 1
+
+typedef enum
+{
+    CompiledLevelSection_Midgrounds,
+    CompiledLevelSection_Grounds,
+    CompiledLevelSection_Pits,
+    CompiledLevelSection_ExitGrounds,
+    CompiledLevelSection_Holes,
+    CompiledLevelSection_ForegroundObjects,
+    CompiledLevelSection_MidBossForegroundObjects,
+    CompiledLevelSection_EndBossForegroundObjects,
+    CompiledLevelSection_CountHissWithMinas,
+    CompiledLevelSection_EndBossSnakes,
+    CompiledLevelSection_Enemies,
+    CompiledLevelSection_CollectibleItems,
+    CompiledLevelSection_Jons,
+    CompiledLevelSection_ExtraForegroundObjects,
+    CompiledLevelSection_ForegroundCoverObjects,
+    CompiledLevelSection_Markers,
+    
+    NUM_COMPILED_LEVEL_SECTIONS
+} CompiledLevelSection;
+
+struct CompiledLevelHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    int32_t world;
+    int32_t level;
+    uint32_t numRecords[NUM_COMPILED_LEVEL_SECTIONS];
+};
+
+struct CompiledLevelRecord
+{
+    int32_t gridX;
+    int32_t gridY;
+    int32_t type;
+};
+
+#endif /* defined(__nosfuratu__CompiledLevel__) */
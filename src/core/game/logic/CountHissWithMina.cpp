@@ -30,6 +30,14 @@ void CountHissWithMina::update(float deltaTime)
     updateBounds();
 }
 
+void CountHissWithMina::resetToSnapshot(int gridX, int gridY)
+{
+    GridLockedPhysicalEntity::resetToSnapshot(gridX, gridY);
+    
+    m_isMoving = false;
+    m_isFacingLeft = false;
+}
+
 bool CountHissWithMina::isMoving()
 {
     return m_isMoving;
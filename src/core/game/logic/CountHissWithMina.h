@@ -24,6 +24,8 @@ public:
     
     virtual void update(float deltaTime);
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     bool isMoving();
     
     void beginMovement();
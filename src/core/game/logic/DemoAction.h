@@ -0,0 +1,24 @@
+//
+//  DemoAction.h
+//  nosfuratu
+//
+
+#ifndef __nosfuratu__DemoAction__
+#define __nosfuratu__DemoAction__
+
+typedef enum
+{
+    DemoAction_Exit,
+    DemoAction_TriggerJump,
+    DemoAction_TriggerTransform,
+    DemoAction_TriggerRight,
+    DemoAction_TriggerUp,
+    DemoAction_TriggerLeft,
+    DemoAction_TriggerDown,
+    DemoAction_TriggerCancelTransform,
+    DemoAction_TriggerHeldTransform, // Holding the screen down, fires after the game has been updated
+    
+    NUM_DEMO_ACTIONS
+} DemoAction;
+
+#endif /* defined(__nosfuratu__DemoAction__) */
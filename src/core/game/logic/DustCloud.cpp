@@ -10,21 +10,34 @@
 
 #include "DustCloud.h"
 
-DustCloud* DustCloud::create(float x, float y, DustCloudType type, float scale)
+DustCloud::DustCloud(float x, float y, float width, float height, DustCloudType type) : PhysicalEntity(x, y, width, height), m_type(type), m_color(1, 1, 1, 1)
 {
-    switch (type) {
+    // Empty
+}
+
+void DustCloud::init(float x, float y, DustCloudType type, float scale)
+{
+    switch (type)
+    {
         case DustCloudType_Landing:
-            return new DustCloud(x, y + 1.4038128249566724f / 2 * scale, 2.690058479532164f * scale, 1.4038128249566724f * scale, type);
+            m_fWidth = 2.690058479532164f * scale;
+            m_fHeight = 1.4038128249566724f * scale;
+            y += m_fHeight / 2;
+            break;
         case DustCloudType_Kick_Up:
-            return new DustCloud(x, y, 0.84375f, 0.28125f, type);
         default:
+            m_fWidth = 0.84375f;
+            m_fHeight = 0.28125f;
             break;
     }
-}
-
-DustCloud::DustCloud(float x, float y, float width, float height, DustCloudType type) : PhysicalEntity(x, y, width, height), m_type(type), m_color(1, 1, 1, 1)
-{
-    // Empty
+    
+    m_position.set(x, y);
+    resetBounds(m_fWidth, m_fHeight);
+    
+    m_type = type;
+    m_color = Color(1, 1, 1, 1);
+    m_fStateTime = 0;
+    m_isRequestingDeletion = false;
 }
 
 void DustCloud::update(float deltaTime)
@@ -21,10 +21,11 @@ class DustCloud : public PhysicalEntity
     RTTI_DECL;
     
 public:
-    static DustCloud* create(float x, float y, DustCloudType type, float scale = 1);
-    
     DustCloud(float x, float y, float width, float height, DustCloudType type);
     
+    // Restarts a recycled cloud
+    void init(float x, float y, DustCloudType type, float scale = 1);
+    
     virtual void update(float deltaTime);
     
     DustCloudType getType();
@@ -0,0 +1,113 @@
+//
+//  EffectPool.h
+//  nosfuratu
+//
+
+#ifndef __nosfuratu__EffectPool__
+#define __nosfuratu__EffectPool__
+
+#include "NGSTDUtil.h"
+
+#include <vector>
+
+// Short lived effects that are recycled instead of deleted.
+// Effects are created on first use only, finished ones go on a free list for the next spawn,
+// and once every effect is live the oldest one is cut short and reused.
+template<typename T>
+class EffectPool
+{
+public:
+    EffectPool(int capacity, T* (*createEffect)()) : m_createEffect(createEffect), m_iCapacity(capacity)
+    {
+        m_effects.reserve(capacity);
+        m_live.reserve(capacity);
+        m_free.reserve(capacity);
+    }
+    
+    ~EffectPool()
+    {
+        NGSTDUtil::cleanUpVectorOfPointers(m_effects);
+    }
+    
+    // The caller reinitializes the effect it gets back, which must clear its deletion request
+    T* spawn()
+    {
+        T* ret;
+        
+        if (m_free.size() > 0)
+        {
+            ret = m_free.back();
+            m_free.pop_back();
+        }
+        else if ((int) m_effects.size() < m_iCapacity)
+        {
+            ret = m_createEffect();
+            m_effects.push_back(ret);
+        }
+        else
+        {
+            ret = m_live.front();
+            m_live.erase(m_live.begin());
+        }
+        
+        m_live.push_back(ret);
+        
+        return ret;
+    }
+    
+    void update(float deltaTime)
+    {
+        for (typename std::vector<T*>::iterator i = m_live.begin(); i != m_live.end(); ++i)
+        {
+            (*i)->update(deltaTime);
+        }
+        
+        clean();
+    }
+    
+    // Hands every effect that requested deletion back to the free list, however old it is
+    void clean()
+    {
+        int count = 0;
+        for (int i = 0; i < (int) m_live.size(); ++i)
+        {
+            T* effect = m_live[i];
+            if (effect->isRequestingDeletion())
+            {
+                m_free.push_back(effect);
+            }
+            else
+            {
+                m_live[count++] = effect;
+            }
+        }
+        
+        m_live.resize(count);
+    }
+    
+    // Hands every live effect back to the free list
+    void clear()
+    {
+        m_free.insert(m_free.end(), m_live.begin(), m_live.end());
+        m_live.clear();
+    }
+    
+    // Live effects, oldest first
+    std::vector<T*>& getEffects()
+    {
+        return m_live;
+    }
+
+private:
+    std::vector<T*> m_effects;
+    std::vector<T*> m_live;
+    std::vector<T*> m_free;
+    T* (*m_createEffect)();
+    int m_iCapacity;
+    
+    // Prevent copying
+    EffectPool(const EffectPool&);
+    EffectPool& operator=(const EffectPool&);
+};
+
+#endif /* defined(__nosfuratu__EffectPool__) */
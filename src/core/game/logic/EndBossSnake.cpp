@@ -67,6 +67,33 @@ EndBossSnake::~EndBossSnake()
     delete m_snakeSpirit;
 }
 
+void EndBossSnake::resetToSnapshot(int gridX, int gridY)
+{
+    GridLockedPhysicalEntity::resetToSnapshot(gridX, gridY);
+    
+    NGSTDUtil::cleanUpVectorOfPointers(m_afterImages);
+    
+    m_state = EndBossSnakeState_Sleeping;
+    m_color = Color(1, 1, 1, 1);
+    m_fTimeSinceLastVelocityCheck = 0;
+    m_iDamage = 0;
+    m_hasPlayedChargeSound = false;
+    
+    float x = m_position.getX();
+    float y = m_position.getY();
+    float w = m_fWidth;
+    float h = m_fHeight;
+	float l = x - w / 2;
+	float b = y - (h / 2);
+    
+    m_snakeSkin->reset(x, y);
+    m_snakeEye->reset(0.52083333333333 * w + l, 0.65073529411765 * h + b);
+    m_snakeTonque->reset(x, y);
+    m_snakeBody->reset();
+    m_snakeHeadImpact->reset(x, y);
+    m_snakeSpirit->reset(x, y);
+}
+
 void EndBossSnake::update(float deltaTime)
 {
     GridLockedPhysicalEntity::update(deltaTime);
@@ -652,6 +679,18 @@ void SnakeSpirit::update(float deltaTime)
     }
 }
 
+void SnakeSpirit::reset(float x, float y)
+{
+    m_fWidth = 51.25f * GRID_CELL_SIZE;
+    m_position.set(x, y);
+    
+    m_fStateTime = 0;
+    m_color = Color(1, 1, 1, 1);
+    m_isShowing = false;
+    
+    updateBounds();
+}
+
 void SnakeSpirit::onDeath()
 {
     EndBossSnake *snake = m_endBossSnake;
@@ -713,6 +752,17 @@ void SnakeHeadImpact::update(float deltaTime)
 	}
 }
 
+void SnakeHeadImpact::reset(float x, float y)
+{
+    m_position.set(x, y);
+    
+    m_fStateTime = 0;
+    m_color = Color(1, 1, 1, 1);
+    m_isShowing = false;
+    
+    updateBounds();
+}
+
 void SnakeHeadImpact::onDamageTaken()
 {
 	EndBossSnake *snake = m_endBossSnake;
@@ -768,6 +818,17 @@ void SnakeSkin::update(float deltaTime)
     }
 }
 
+void SnakeSkin::reset(float x, float y)
+{
+    m_position.set(x, y);
+    
+    m_fStateTime = 0;
+    m_color = Color(1, 1, 1, 1);
+    m_isShowing = false;
+    
+    updateBounds();
+}
+
 void SnakeSkin::onDamageTaken()
 {
     EndBossSnake *snake = m_endBossSnake;
@@ -817,6 +878,17 @@ void SnakeEye::update(float deltaTime)
     }
 }
 
+void SnakeEye::reset(float x, float y)
+{
+    m_position.set(x, y);
+    
+    m_fStateTime = 0;
+    m_isWakingUp = false;
+    m_isShowing = true;
+    
+    updateBounds();
+}
+
 void SnakeEye::onAwaken()
 {
     m_fStateTime = 0;
@@ -865,6 +937,16 @@ void SnakeTonque::update(float deltaTime)
 	}
 }
 
+void SnakeTonque::reset(float x, float y)
+{
+    m_position.set(x, y);
+    
+    m_fStateTime = 0;
+    m_isMouthOpen = false;
+    
+    updateBounds();
+}
+
 void SnakeTonque::onMouthOpen()
 {
 	update(0);
@@ -950,6 +1032,16 @@ void SnakeBody::updateBounds()
     getMainBounds().setHeight(getHeight() * 0.50f);
 }
 
+void SnakeBody::reset()
+{
+    m_fStateTime = 0;
+    m_color = Color(1, 1, 1, 1);
+    m_isDead = false;
+    
+    // Lines back up with the snake, which has to be asleep again by now
+    update(0);
+}
+
 void SnakeBody::onDeath()
 {
     update(0);
@@ -40,6 +40,8 @@ public:
     
     virtual void update(float deltaTime);
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
 	void begin();
 
 	void awaken();
@@ -101,6 +103,8 @@ public:
     
     virtual void update(float deltaTime);
     
+    void reset(float x, float y);
+    
     void onDeath();
     
     EndBossSnake& getEndBossSnake();
@@ -122,6 +126,8 @@ public:
     
     virtual void update(float deltaTime);
     
+    void reset(float x, float y);
+    
     void onDamageTaken();
     
     EndBossSnake& getEndBossSnake();
@@ -143,6 +149,8 @@ public:
     
     virtual void update(float deltaTime);
     
+    void reset(float x, float y);
+    
     void onDamageTaken();
     
     EndBossSnake& getEndBossSnake();
@@ -164,6 +172,8 @@ public:
     
     virtual void update(float deltaTime);
     
+    void reset(float x, float y);
+    
     void onAwaken();
     
     EndBossSnake& getEndBossSnake();
@@ -183,6 +193,8 @@ public:
     
     virtual void update(float deltaTime);
     
+    void reset(float x, float y);
+    
     void onMouthOpen();
     
     void onMouthClose();
@@ -207,6 +219,8 @@ public:
     
     virtual void updateBounds();
     
+    void reset();
+    
     void onDeath();
     
     EndBossSnake& getEndBossSnake();
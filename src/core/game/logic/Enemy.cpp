@@ -94,6 +94,19 @@ void Enemy::updateBounds()
     }
 }
 
+void Enemy::resetToSnapshot(int gridX, int gridY)
+{
+    GridLockedPhysicalEntity::resetToSnapshot(gridX, gridY);
+    
+    // Only the alpha changes after construction, some snakes are tinted
+    m_color.alpha = 2;
+    m_fEnemySpiritStateTime = 0;
+    m_fXOfDeath = 0;
+    m_fYOfDeath = 0;
+    m_isDying = false;
+    m_isDead = false;
+}
+
 void Enemy::triggerHit()
 {
     m_isDying = true;
@@ -107,7 +120,7 @@ void Enemy::triggerHit()
 bool Enemy::isEntityLanding(PhysicalEntity* entity, float deltaTime)
 {
     Jon *jon = nullptr;
-    if (entity->getRTTI().derivesFrom(Jon::rtti))
+    if (entity->getTypeTags() & TYPE_TAG_JON)
     {
         jon = reinterpret_cast<Jon *>(entity);
         if (calcIsJonLanding(jon, deltaTime))
@@ -174,7 +187,8 @@ Enemy::~Enemy()
 
 bool Enemy::hasSpirit()
 {
-    return m_enemySpirit ? true : false;
+    // The spirit is kept after the enemy is restarted, so it only counts once the enemy has died again
+    return m_isDead && m_enemySpirit ? true : false;
 }
 
 EnemySpirit& Enemy::getSpirit()
@@ -225,7 +239,14 @@ void Enemy::handleDying(float deltaTime)
         m_color.alpha = 1;
         m_isDead = true;
         
-        m_enemySpirit = EnemySpirit::create(m_fXOfDeath, m_fYOfDeath, m_enemySpiritType);
+        if (m_enemySpirit)
+        {
+            m_enemySpirit->reset(m_fXOfDeath, m_fYOfDeath);
+        }
+        else
+        {
+            m_enemySpirit = EnemySpirit::create(m_fXOfDeath, m_fYOfDeath, m_enemySpiritType);
+        }
     }
 }
 
@@ -321,6 +342,14 @@ Mushroom::Mushroom(int gridX, int gridY, int gridWidth, int gridHeight, float bo
     // Empty
 }
 
+void Mushroom::resetToSnapshot(int gridX, int gridY)
+{
+    Enemy::resetToSnapshot(gridX, gridY);
+    
+    m_isBeingBouncedOn = false;
+    m_isBouncingBack = false;
+}
+
 void Mushroom::handleAlive(float deltaTime)
 {
     Entity::update(deltaTime);
@@ -373,7 +402,7 @@ MushroomGround::MushroomGround(int gridX, int gridY) : Mushroom(gridX, gridY, 7,
 bool MushroomGround::isEntityLanding(PhysicalEntity* entity, float deltaTime)
 {
     Jon *jon = nullptr;
-    if (entity->getRTTI().derivesFrom(Jon::rtti))
+    if (entity->getTypeTags() & TYPE_TAG_JON)
     {
         jon = reinterpret_cast<Jon *>(entity);
         if (calcIsJonLanding(jon, deltaTime))
@@ -458,6 +487,14 @@ void Sparrow::updateBounds()
     }
 }
 
+void Sparrow::resetToSnapshot(int gridX, int gridY)
+{
+    Enemy::resetToSnapshot(gridX, gridY);
+    
+    m_fOriginalY = m_position.getY();
+    m_isOnScreen = false;
+}
+
 void Sparrow::onMoved()
 {
     m_fOriginalY = m_position.getY();
@@ -493,6 +530,16 @@ m_isJonVampire(false)
     // Empty
 }
 
+void Toad::resetToSnapshot(int gridX, int gridY)
+{
+    Enemy::resetToSnapshot(gridX, gridY);
+    
+    m_isDeadPart1 = false;
+    m_isEating = false;
+    m_hasSwallowedJon = false;
+    m_isJonVampire = false;
+}
+
 bool Toad::isDeadPart1()
 {
     return m_isDeadPart1;
@@ -672,10 +719,20 @@ void Fox::updateBounds()
 	}
 }
 
+void Fox::resetToSnapshot(int gridX, int gridY)
+{
+    Enemy::resetToSnapshot(gridX, gridY);
+    
+    m_isHitting = false;
+    m_isLeft = true;
+    m_isBeingHit = false;
+    m_isOnScreen = false;
+}
+
 bool Fox::isEntityLanding(PhysicalEntity* entity, float deltaTime)
 {
     Jon *jon = nullptr;
-    if (entity->getRTTI().derivesFrom(Jon::rtti))
+    if (entity->getTypeTags() & TYPE_TAG_JON)
     {
         jon = reinterpret_cast<Jon *>(entity);
         if (calcIsJonLanding(jon, deltaTime))
@@ -854,7 +911,7 @@ void BigMushroomGround::handleAlive(float deltaTime)
 bool BigMushroomGround::isEntityLanding(PhysicalEntity* entity, float deltaTime)
 {
     Jon *jon = nullptr;
-    if (entity->getRTTI().derivesFrom(Jon::rtti))
+    if (entity->getTypeTags() & TYPE_TAG_JON)
     {
         jon = reinterpret_cast<Jon *>(entity);
         if (calcIsJonLanding(jon, deltaTime))
@@ -936,6 +993,17 @@ void MovingSnakeGrunt::updateBounds()
     }
 }
 
+void MovingSnakeGrunt::resetToSnapshot(int gridX, int gridY)
+{
+    Enemy::resetToSnapshot(gridX, gridY);
+    
+    m_isPausing = false;
+    m_isPreparingToJump = false;
+    m_isLanding = false;
+    m_isGrounded = false;
+    m_isOnScreen = false;
+}
+
 bool MovingSnakeGrunt::isPreparingToJump()
 {
     return m_isPreparingToJump;
@@ -36,6 +36,8 @@ public:
     
     virtual void updateBounds();
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     void triggerHit();
     
     virtual bool isEntityLanding(PhysicalEntity* entity, float deltaTime);
@@ -97,6 +99,8 @@ class Mushroom : public Enemy
 public:
     Mushroom(int gridX, int gridY, int gridWidth, int gridHeight, float boundsX, float boundsY, float boundsWidth, float boundsHeight, EnemyType type);
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     virtual void handleAlive(float deltaTime);
     
     virtual bool isJonHittingHorizontally(Jon& jon, float deltaTime);
@@ -148,6 +152,8 @@ public:
     Sparrow(int gridX, int gridY);
     
     virtual void updateBounds();
+    
+    virtual void resetToSnapshot(int gridX, int gridY);
 
     void onMoved();
     
@@ -166,6 +172,8 @@ class Toad : public Enemy
 public:
     Toad(int gridX, int gridY);
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     bool isDeadPart1();
     bool isEating();
     bool hasSwallowedJon();
@@ -193,6 +201,8 @@ public:
 
 	virtual void updateBounds();
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     virtual bool isEntityLanding(PhysicalEntity* entity, float deltaTime);
     
     bool isHitting();
@@ -246,6 +256,8 @@ public:
     
     virtual void updateBounds();
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     bool isPreparingToJump();
     bool isLanding();
     bool isPausing();
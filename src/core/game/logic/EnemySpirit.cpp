@@ -12,14 +12,19 @@
 
 #include "EntityUtils.h"
 
+static float calcOffsetY(EnemySpiritType type)
+{
+    return type == EnemySpiritType_Sparrow ? 1.546875f : 0;
+}
+
 EnemySpirit* EnemySpirit::create(float x, float y, EnemySpiritType type)
 {
     switch (type)
     {
         case EnemySpiritType_Snake:
-            return new EnemySpirit(x, y, 1.828125f, 2.25f, type);
+            return new EnemySpirit(x, y + calcOffsetY(type), 1.828125f, 2.25f, type);
         case EnemySpiritType_Sparrow:
-            return new EnemySpirit(x, y + 1.546875f, 2.25f, 4.5f, type);
+            return new EnemySpirit(x, y + calcOffsetY(type), 2.25f, 4.5f, type);
         case EnemySpiritType_None:
             return nullptr;
     }
@@ -42,6 +47,16 @@ void EnemySpirit::update(float deltaTime)
     }
 }
 
+void EnemySpirit::reset(float x, float y)
+{
+    m_position.set(x, y + calcOffsetY(m_type));
+    
+    m_fStateTime = 0;
+    m_isRequestingDeletion = false;
+    
+    updateBounds();
+}
+
 EnemySpiritType EnemySpirit::getType()
 {
     return m_type;
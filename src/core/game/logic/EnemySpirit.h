@@ -26,6 +26,8 @@ public:
     
     virtual void update(float deltaTime);
     
+    void reset(float x, float y);
+    
     EnemySpiritType getType();
     
 private:
@@ -24,6 +24,11 @@
 #include "ExitGround.h"
 #include "Midground.h"
 #include "ForegroundCoverObject.h"
+#include "GameSnapshot.h"
+#include "CompiledLevel.h"
+#include "LevelJsonHandler.h"
+#include "ActivityIndex.h"
+#include "NGSTDUtil.h"
 
 #include "rapidjson/document.h"
 #include "rapidjson/writer.h"
@@ -31,10 +36,9 @@
 
 #include <math.h>
 #include <vector>
+#include <algorithm>
 
-#define gridXKey "gridX"
-#define gridYKey "gridY"
-#define typeKey "type"
+#define MAX_NUM_LOCAL_LANDING_CANDIDATES 64
 
 class EntityUtils
 {
@@ -95,39 +99,39 @@ public:
         
         if (entityVelocityY <= 0)
         {
-			int highestPriority = 0;
-			for (typename std::vector<T>::iterator i = items.begin(); i != items.end(); ++i)
-			{
-				if ((*i) == entity)
-				{
-					continue;
-				}
-
-				int priority = (*i)->getEntityLandingPriority();
-				if (priority > highestPriority)
-				{
-					highestPriority = priority;
-				}
-			}
-
-			for (int p = highestPriority; p >= 0; p--)
-			{
-				for (typename std::vector<T>::iterator i = items.begin(); i != items.end(); ++i)
-				{
-					if ((*i) == entity)
-					{
-						continue;
-					}
-
-					int priority = (*i)->getEntityLandingPriority();
-
-					if (p == priority
-						&& (*i)->isEntityLanding(entity, deltaTime))
-					{
-						return true;
-					}
-				}
-			}
+            // Each candidate's priority is read once, then candidates are tried highest priority first, in vector order within a priority
+            int numItems = (int) items.size();
+            int localPriorities[MAX_NUM_LOCAL_LANDING_CANDIDATES];
+            std::vector<int> heapPriorities;
+            int* priorities = localPriorities;
+            if (numItems > MAX_NUM_LOCAL_LANDING_CANDIDATES)
+            {
+                heapPriorities.resize(numItems);
+                priorities = &heapPriorities[0];
+            }
+            
+            int highestPriority = -1;
+            for (int i = 0; i < numItems; ++i)
+            {
+                // Negative priorities never land, and neither does an entity on itself
+                priorities[i] = items[i] == entity ? -1 : items[i]->getEntityLandingPriority();
+                if (priorities[i] > highestPriority)
+                {
+                    highestPriority = priorities[i];
+                }
+            }
+            
+            for (int p = highestPriority; p >= 0; p--)
+            {
+                for (int i = 0; i < numItems; ++i)
+                {
+                    if (priorities[i] == p
+                        && items[i]->isEntityLanding(entity, deltaTime))
+                    {
+                        return true;
+                    }
+                }
+            }
         }
         
         return false;
@@ -168,7 +172,7 @@ public:
             {
                 if (entityLeft >= itemLeft && entityRight <= itemRight)
                 {
-                    if ((*i)->getRTTI().derivesFrom(PitTunnel::rtti))
+                    if ((*i)->getTypeTags() & TYPE_TAG_PIT_TUNNEL)
                     {
                         float entityTop = entity->getMainBounds().getTop();
                         float itemTop = (*i)->getPosition().getY() + (*i)->getHeight() / 2;
@@ -210,7 +214,7 @@ public:
     static bool shouldJonGrabLedge(PhysicalEntity* entity, std::vector<T*>& items, float deltaTime)
     {
         Jon *jon = nullptr;
-        if (entity->getRTTI().derivesFrom(Jon::rtti))
+        if (entity->getTypeTags() & TYPE_TAG_JON)
         {
             jon = reinterpret_cast<Jon *>(entity);
         }
@@ -230,36 +234,18 @@ public:
         
         for (typename std::vector<T*>::iterator i = items.begin(); i != items.end(); ++i)
         {
-            if ((*i)->getRTTI().derivesFrom(Ground::rtti)
-                && (((Ground *)(*i))->getType() == GroundType_CaveDeepLarge
-                    || ((Ground *)(*i))->getType() == GroundType_CaveDeepMedium
-                    || ((Ground *)(*i))->getType() == GroundType_CaveDeepSmall
-                    || ((Ground *)(*i))->getType() == GroundType_CaveDeepEndRight))
-            {
-                continue;
-            }
+            int typeTags = (*i)->getTypeTags();
             
-            if ((*i)->getRTTI().derivesFrom(BlockingObject::rtti)
-                    && (((BlockingObject *)(*i))->getType() == ForegroundObjectType_Stone_Bottom
-                        || ((BlockingObject *)(*i))->getType() == ForegroundObjectType_Stone_Middle))
+            // Deep cave ground, stones, trees, walls and the inner platform pieces are never grabbed
+            if (typeTags & TYPE_TAG_NO_LEDGE_GRAB)
             {
                 continue;
             }
             
-            if ((*i)->getRTTI().derivesFrom(PlatformObject::rtti))
+            if (typeTags & TYPE_TAG_PLATFORM)
             {
                 // Special Behavior here
                 PlatformObject* platformObj = (PlatformObject *)(*i);
-                if (platformObj->getType() == ForegroundObjectType_GrassPlatformCenter
-                    || platformObj->getType() == ForegroundObjectType_GrassPlatformRight
-                    || platformObj->getType() == ForegroundObjectType_CavePlatformCenter
-                    || platformObj->getType() == ForegroundObjectType_CavePlatformRight
-                    || platformObj->getType() == ForegroundObjectType_MetalGrassPlatformCenter
-                    || platformObj->getType() == ForegroundObjectType_MetalGrassPlatformRight)
-                {
-                    continue;
-                }
-                
                 if (platformObj->shouldJonGrabLedge(entity, deltaTime))
                 {
                     float itemTop = (*i)->getMainBounds().getTop();
@@ -283,27 +269,7 @@ public:
                 }
             }
             
-            if ((*i)->getRTTI().derivesFrom(DeathFromAboveObject::rtti)
-                || (*i)->getRTTI().derivesFrom(LandingDeathObject::rtti)
-                || (*i)->getRTTI().derivesFrom(DeadlyObject::rtti))
-            {
-                continue;
-            }
-            
-            if ((*i)->getRTTI().derivesFrom(ForegroundObject::rtti)
-                && (((ForegroundObject *)(*i))->getType() == ForegroundObjectType_GiantPerchTree
-                    || ((ForegroundObject *)(*i))->getType() == ForegroundObjectType_GiantTree
-                    || ((ForegroundObject *)(*i))->getType() == ForegroundObjectType_GiantShakingTree
-                    || ((ForegroundObject *)(*i))->getType() == ForegroundObjectType_WoodBox))
-            {
-                continue;
-            }
-            
-            if ((*i)->getRTTI().derivesFrom(ForegroundCoverObject::rtti)
-                && (((ForegroundCoverObject *)(*i))->getType() == ForegroundCoverObjectType_Wall
-                    || ((ForegroundCoverObject *)(*i))->getType() == ForegroundCoverObjectType_Wall_Bottom
-                    || ((ForegroundCoverObject *)(*i))->getType() == ForegroundCoverObjectType_Wall_Window
-                    || ((ForegroundCoverObject *)(*i))->getType() == ForegroundCoverObjectType_Wall_Window_Bottom))
+            if (typeTags & TYPE_TAG_DEADLY)
             {
                 continue;
             }
@@ -490,23 +456,100 @@ public:
         }
     }
     
+    // Deleted entities go to pendingFrees when given, so the caller can free a whole tick's worth at once
     template<typename T>
-    static void updateAndClean(std::vector<T*>& items, float deltaTime)
+    static void updateAndClean(std::vector<T*>& items, float deltaTime, std::vector<Entity*>* pendingFrees = nullptr)
     {
-        for (typename std::vector<T*>::iterator i = items.begin(); i != items.end(); )
+        int numItems = (int) items.size();
+        int firstDeleted = numItems;
+        for (int i = 0; i < numItems; ++i)
         {
-            (*i)->update(deltaTime);
+            items[i]->update(deltaTime);
             
-            if ((*i)->isRequestingDeletion())
+            if (firstDeleted == numItems
+                && items[i]->isRequestingDeletion())
             {
-                delete *i;
-                i = items.erase(i);
+                firstDeleted = i;
+            }
+        }
+        
+        // One pass slides the survivors down in order, instead of an erase per deleted entity
+        int count = firstDeleted;
+        for (int i = firstDeleted; i < numItems; ++i)
+        {
+            if (items[i]->isRequestingDeletion())
+            {
+                release(items[i], pendingFrees);
+            }
+            else
+            {
+                items[count++] = items[i];
+            }
+        }
+        
+        items.resize(count);
+    }
+    
+    template<typename T>
+    static void updateAndClean(std::vector<T*>& items, ActivityIndex* activityIndex, float deltaTime, std::vector<Entity*>* pendingFrees = nullptr)
+    {
+        // Only the slots gathered into the index are updated, the deleted ones are packed to the front of the same list
+        std::vector<int>& activeSlots = activityIndex->getActiveSlots();
+        int numDeleted = 0;
+        for (int i = 0; i < (int) activeSlots.size(); ++i)
+        {
+            int slot = activeSlots[i];
+            T* item = items[slot];
+            
+            item->update(deltaTime);
+            
+            if (item->isRequestingDeletion())
+            {
+                activeSlots[numDeleted++] = slot;
+            }
+        }
+        
+        activeSlots.resize(numDeleted);
+        
+        if (numDeleted == 0)
+        {
+            return;
+        }
+        
+        int numItems = (int) items.size();
+        int count = activeSlots[0];
+        int next = 0;
+        for (int i = count; i < numItems; ++i)
+        {
+            if (next < numDeleted
+                && activeSlots[next] == i)
+            {
+                release(items[i], pendingFrees);
+                
+                next++;
             }
             else
             {
-                ++i;
+                items[count++] = items[i];
             }
         }
+        
+        items.resize(count);
+        
+        activityIndex->remove(activeSlots);
+    }
+    
+    template<typename T>
+    static void release(T* item, std::vector<Entity*>* pendingFrees)
+    {
+        if (pendingFrees)
+        {
+            pendingFrees->push_back(item);
+        }
+        else
+        {
+            delete item;
+        }
     }
     
     template<typename T>
@@ -720,6 +763,54 @@ public:
         }
     }
     
+    template<typename T>
+    static void takeSnapshot(std::vector<T*>& items, std::vector<EntitySnapshot>& snapshots)
+    {
+        snapshots.clear();
+        snapshots.reserve(items.size());
+        
+        for (typename std::vector<T*>::iterator i = items.begin(); i != items.end(); ++i)
+        {
+            EntitySnapshot snapshot;
+            snapshot.entity = *i;
+            snapshot.gridX = (*i)->getGridX();
+            snapshot.gridY = (*i)->getGridY();
+            
+            snapshots.push_back(snapshot);
+        }
+    }
+    
+    // Puts the snapshot entities back in the vector in their original order, reset in place
+    template<typename T>
+    static void restoreSnapshot(std::vector<T*>& items, std::vector<EntitySnapshot>& snapshots)
+    {
+        items.clear();
+        items.reserve(snapshots.size());
+        
+        for (std::vector<EntitySnapshot>::iterator i = snapshots.begin(); i != snapshots.end(); ++i)
+        {
+            T* item = static_cast<T*>((*i).entity);
+            item->resetToSnapshot((*i).gridX, (*i).gridY);
+            
+            items.push_back(item);
+        }
+    }
+    
+    // Deletes whatever isn't kept by the snapshot, like loop marker copies, and empties the vector
+    template<typename T>
+    static void freeOutsideSnapshot(std::vector<T*>& items, std::vector<GridLockedPhysicalEntity*>& snapshotEntities)
+    {
+        for (typename std::vector<T*>::iterator i = items.begin(); i != items.end(); ++i)
+        {
+            if (!std::binary_search(snapshotEntities.begin(), snapshotEntities.end(), *i))
+            {
+                delete *i;
+            }
+        }
+        
+        items.clear();
+    }
+    
     template<typename T>
     static void serialize(T* item, rapidjson::Writer<rapidjson::StringBuffer>& w)
     {
@@ -739,34 +830,22 @@ public:
     }
     
     template<typename T>
-    static T* deserialize(rapidjson::Value& v)
+    static const CompiledLevelRecord* loadRecords(std::vector<T*>& items, const CompiledLevelRecord* records, uint32_t numRecords)
     {
-        int gridX = v[gridXKey].GetInt();
-        int gridY = v[gridYKey].GetInt();
-        int type = 0;
-        if (v.HasMember(typeKey))
+        items.reserve(items.size() + numRecords);
+        
+        for (uint32_t i = 0; i < numRecords; ++i)
         {
-            type = v[typeKey].GetInt();
+            items.push_back(T::create(records[i].gridX, records[i].gridY, records[i].type));
         }
         
-        return T::create(gridX, gridY, type);
+        return records + numRecords;
     }
     
     template<typename T>
-    static void loadArray(std::vector<T*>& items, rapidjson::Document& d, const char * key)
+    static void loadRecord(std::vector<T*>& items, const CompiledLevelRecord& record)
     {
-        using namespace rapidjson;
-        
-        if (d.HasMember(key))
-        {
-            Value& v = d[key];
-            assert(v.IsArray());
-            
-            for (SizeType i = 0; i < v.Size(); ++i)
-            {
-                items.push_back(deserialize<T>(v[i]));
-            }
-        }
+        items.push_back(T::create(record.gridX, record.gridY, record.type));
     }
     
     template<typename T>
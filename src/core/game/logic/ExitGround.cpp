@@ -46,21 +46,34 @@ ExitGround::ExitGround(int gridX, int gridY, int gridWidth, int gridHeight, floa
     }
 }
 
+ExitGround::~ExitGround()
+{
+    delete m_exitCover;
+    m_exitCover = nullptr;
+}
+
 void ExitGround::update(float deltaTime)
 {
     PhysicalEntity::update(deltaTime);
     
-    if (m_exitCover)
+    if (hasCover())
     {
         m_exitCover->update(deltaTime);
         m_exitCover->getPosition().set(getPosition());
         m_exitCover->updateBounds();
-        
-        if (m_exitCover->isRequestingDeletion())
-        {
-            delete m_exitCover;
-            m_exitCover = nullptr;
-        }
+    }
+}
+
+void ExitGround::resetToSnapshot(int gridX, int gridY)
+{
+    GridLockedPhysicalEntity::resetToSnapshot(gridX, gridY);
+    
+    updateBounds();
+    
+    // A broken cover is kept around so a restart can put it back
+    if (m_exitCover)
+    {
+        m_exitCover->reset(m_position.getX(), m_position.getY());
     }
 }
 
@@ -95,7 +108,7 @@ bool ExitGround::isEntityLanding(PhysicalEntity* entity, float deltaTime)
 				entity->placeOn(itemTop);
                 
                 Jon *jon = nullptr;
-                if (entity->getRTTI().derivesFrom(Jon::rtti))
+                if (entity->getTypeTags() & TYPE_TAG_JON)
                 {
                     jon = reinterpret_cast<Jon *>(entity);
                     jon->setGroundSoundType(getGroundSoundType());
@@ -148,7 +161,7 @@ bool ExitGround::canObjectBePlacedOn()
 
 bool ExitGround::hasCover()
 {
-    return m_exitCover ? true : false;
+    return m_exitCover && !m_exitCover->isRequestingDeletion() ? true : false;
 }
 
 ExitGroundCover& ExitGround::getExitCover()
@@ -196,7 +209,7 @@ bool CaveDeepSmallWaterfall::isEntityLanding(PhysicalEntity* entity, float delta
 				entity->placeOn(itemTop);
                 
                 Jon *jon = nullptr;
-                if (entity->getRTTI().derivesFrom(Jon::rtti))
+                if (entity->getTypeTags() & TYPE_TAG_JON)
                 {
                     jon = reinterpret_cast<Jon *>(entity);
                     jon->setGroundSoundType(getGroundSoundType());
@@ -28,8 +28,12 @@ public:
     
     ExitGround(int gridX, int gridY, int gridWidth, int gridHeight, float boundsHeight, bool hasCover, ExitGroundType type, GroundSoundType groundSoundType);
     
+    virtual ~ExitGround();
+    
     virtual void update(float deltaTime);
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     virtual bool isEntityLanding(PhysicalEntity* entity, float deltaTime);
 
     virtual int getEntityLandingPriority();
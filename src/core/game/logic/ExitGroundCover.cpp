@@ -34,6 +34,18 @@ void ExitGroundCover::update(float deltaTime)
     }
 }
 
+void ExitGroundCover::reset(float x, float y)
+{
+    m_position.set(x, y);
+    
+    m_color.alpha = 1;
+    m_fStateTime = 0;
+    m_isRequestingDeletion = false;
+    m_isBreaking = false;
+    
+    updateBounds();
+}
+
 void ExitGroundCover::triggerHit()
 {
     m_isBreaking = true;
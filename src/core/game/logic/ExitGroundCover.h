@@ -25,6 +25,8 @@ public:
     
     virtual void update(float deltaTime);
     
+    void reset(float x, float y);
+    
     void triggerHit();
     
     ExitGroundCoverType getType();
@@ -59,9 +59,23 @@ ForegroundCoverObject* ForegroundCoverObject::create(int gridX, int gridY, int t
     assert(false);
 }
 
+static int calcCapabilityTags(ForegroundCoverObjectType type)
+{
+    switch (type)
+    {
+        case ForegroundCoverObjectType_Wall:
+        case ForegroundCoverObjectType_Wall_Bottom:
+        case ForegroundCoverObjectType_Wall_Window:
+        case ForegroundCoverObjectType_Wall_Window_Bottom:
+            return TYPE_TAG_NO_LEDGE_GRAB;
+        default:
+            return 0;
+    }
+}
+
 ForegroundCoverObject::ForegroundCoverObject(int gridX, int gridY, int gridWidth, int gridHeight, ForegroundCoverObjectType type, GroundSoundType groundSoundType, float boundsX, float boundsY, float boundsWidth, float boundsHeight) : GridLockedPhysicalEntity(gridX, gridY, gridWidth, gridHeight, boundsX, boundsY, boundsWidth, boundsHeight), m_type(type), m_groundSoundType(groundSoundType), m_game(nullptr), m_color(1, 1, 1, 1)
 {
-    // Empty
+    m_iCapabilityTags = calcCapabilityTags(type);
 }
 
 bool ForegroundCoverObject::isEntityLanding(PhysicalEntity* entity, float deltaTime)
@@ -156,7 +170,7 @@ bool LandableForegroundCoverObject::isEntityLanding(PhysicalEntity* entity, floa
                 entity->placeOn(getMainBounds().getTop());
                 
                 Jon *jon = nullptr;
-                if (entity->getRTTI().derivesFrom(Jon::rtti))
+                if (entity->getTypeTags() & TYPE_TAG_JON)
                 {
                     jon = reinterpret_cast<Jon *>(entity);
                     jon->setGroundSoundType(getGroundSoundType());
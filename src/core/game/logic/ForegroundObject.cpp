@@ -23,6 +23,28 @@
 
 #include <math.h>
 
+static int calcCapabilityTags(ForegroundObjectType type)
+{
+    switch (type)
+    {
+        case ForegroundObjectType_GrassPlatformCenter:
+        case ForegroundObjectType_GrassPlatformRight:
+        case ForegroundObjectType_CavePlatformCenter:
+        case ForegroundObjectType_CavePlatformRight:
+        case ForegroundObjectType_MetalGrassPlatformCenter:
+        case ForegroundObjectType_MetalGrassPlatformRight:
+        case ForegroundObjectType_Stone_Bottom:
+        case ForegroundObjectType_Stone_Middle:
+        case ForegroundObjectType_GiantPerchTree:
+        case ForegroundObjectType_GiantTree:
+        case ForegroundObjectType_GiantShakingTree:
+        case ForegroundObjectType_WoodBox:
+            return TYPE_TAG_NO_LEDGE_GRAB;
+        default:
+            return 0;
+    }
+}
+
 ForegroundObject* ForegroundObject::create(int gridX, int gridY, int type)
 {
     ForegroundObjectType fot = (ForegroundObjectType)type;
@@ -188,7 +210,14 @@ ForegroundObject* ForegroundObject::create(int gridX, int gridY, int type)
 
 ForegroundObject::ForegroundObject(int gridX, int gridY, int gridWidth, int gridHeight, ForegroundObjectType type, GroundSoundType groundSoundType, float boundsX, float boundsY, float boundsWidth, float boundsHeight) : GridLockedPhysicalEntity(gridX, gridY, gridWidth, gridHeight, boundsX, boundsY, boundsWidth, boundsHeight), m_type(type), m_groundSoundType(groundSoundType), m_game(nullptr), m_color(1, 1, 1, 1)
 {
-    // Empty
+    m_iCapabilityTags = calcCapabilityTags(type);
+}
+
+void ForegroundObject::resetToSnapshot(int gridX, int gridY)
+{
+    GridLockedPhysicalEntity::resetToSnapshot(gridX, gridY);
+    
+    m_color = Color(1, 1, 1, 1);
 }
 
 bool ForegroundObject::isEntityLanding(PhysicalEntity* entity, float deltaTime)
@@ -280,7 +309,7 @@ bool ForegroundObject::isEntityLanding(PhysicalEntity* entity, NGRect& bounds, f
 				entity->placeOn(bounds.getTop());
 
                 Jon *jon = nullptr;
-                if (entity->getRTTI().derivesFrom(Jon::rtti))
+                if (entity->getTypeTags() & TYPE_TAG_JON)
                 {
                     jon = reinterpret_cast<Jon *>(entity);
 					jon->setGroundSoundType(getGroundSoundType());
@@ -425,6 +454,27 @@ void FloatingPlatformObject::update(float deltaTime)
     }
 }
 
+void FloatingPlatformObject::resetToSnapshot(int gridX, int gridY)
+{
+    PlatformObject::resetToSnapshot(gridX, gridY);
+    
+    m_isIdle = true;
+    m_isWeighted = false;
+    
+    float x = m_position.getX();
+    float y = m_position.getY() - m_fHeight / 2 + 0.1f;
+    m_idlePoof->getPosition().set(x, y - 0.31640625f / 2);
+    m_addedWeightPoof->getPosition().set(x, y - 1.51171875f / 2);
+    
+    m_idlePoof->setStateTime(0);
+    m_addedWeightPoof->setStateTime(0);
+    
+    m_idlePoof->updateBounds();
+    m_addedWeightPoof->updateBounds();
+    
+    onMoved();
+}
+
 bool FloatingPlatformObject::isEntityLanding(PhysicalEntity* entity, float deltaTime)
 {
     if (PlatformObject::isEntityLanding(entity, deltaTime))
@@ -493,7 +543,7 @@ bool DeadlyObject::isEntityLanding(PhysicalEntity* entity, float deltaTime)
     if (ForegroundObject::isEntityLanding(entity, deltaTime))
     {
         Jon *jon = nullptr;
-        if (entity->getRTTI().derivesFrom(Jon::rtti))
+        if (entity->getTypeTags() & TYPE_TAG_JON)
         {
             jon = reinterpret_cast<Jon *>(entity);
             jon->kill();
@@ -520,7 +570,7 @@ bool DeadlyObject::isEntityBlockedOnRight(PhysicalEntity* entity, float deltaTim
     if (ForegroundObject::isEntityBlockedOnRight(entity, deltaTime))
     {
         Jon *jon = nullptr;
-        if (entity->getRTTI().derivesFrom(Jon::rtti))
+        if (entity->getTypeTags() & TYPE_TAG_JON)
         {
             jon = reinterpret_cast<Jon *>(entity);
             jon->kill();
@@ -563,7 +613,7 @@ bool DeadlyObject::isEntityBlockedOnLeft(PhysicalEntity* entity, float deltaTime
 	if (ForegroundObject::isEntityBlockedOnLeft(entity, deltaTime))
 	{
         Jon *jon = nullptr;
-        if (entity->getRTTI().derivesFrom(Jon::rtti))
+        if (entity->getTypeTags() & TYPE_TAG_JON)
         {
             jon = reinterpret_cast<Jon *>(entity);
 			jon->kill();
@@ -599,7 +649,7 @@ bool LandingDeathObject::isEntityLanding(PhysicalEntity* entity, float deltaTime
     if (ForegroundObject::isEntityLanding(entity, deltaTime))
     {
         Jon *jon = nullptr;
-        if (entity->getRTTI().derivesFrom(Jon::rtti))
+        if (entity->getTypeTags() & TYPE_TAG_JON)
         {
             jon = reinterpret_cast<Jon *>(entity);
             jon->kill();
@@ -624,7 +674,7 @@ bool RunningIntoDeathObject::isEntityBlockedOnRight(PhysicalEntity* entity, floa
     if (ForegroundObject::isEntityBlockedOnRight(entity, deltaTime))
     {
         Jon *jon = nullptr;
-        if (entity->getRTTI().derivesFrom(Jon::rtti))
+        if (entity->getTypeTags() & TYPE_TAG_JON)
         {
             jon = reinterpret_cast<Jon *>(entity);
             jon->kill();
@@ -672,6 +722,13 @@ void ProvideBoostObject::update(float deltaTime)
     }
 }
 
+void ProvideBoostObject::resetToSnapshot(int gridX, int gridY)
+{
+    ForegroundObject::resetToSnapshot(gridX, gridY);
+    
+    m_isBoosting = false;
+}
+
 bool ProvideBoostObject::isEntityLanding(PhysicalEntity* entity, float deltaTime)
 {
     if (ForegroundObject::isEntityLanding(entity, deltaTime))
@@ -680,7 +737,7 @@ bool ProvideBoostObject::isEntityLanding(PhysicalEntity* entity, float deltaTime
         entity->getPosition().setY(itemTop + entity->getMainBounds().getHeight() / 2 * 1.01f);
         
         Jon *jon = nullptr;
-        if (entity->getRTTI().derivesFrom(Jon::rtti))
+        if (entity->getTypeTags() & TYPE_TAG_JON)
         {
             jon = reinterpret_cast<Jon *>(entity);
             jon->triggerBoost(m_fBoostVelocity);
@@ -722,6 +779,13 @@ void ExtraForegroundObject::update(float deltaTime)
     m_shadow->updateBounds();
 }
 
+void ExtraForegroundObject::resetToSnapshot(int gridX, int gridY)
+{
+    ForegroundObject::resetToSnapshot(gridX, gridY);
+    
+    m_shadow->resetToSnapshot(gridX, gridY);
+}
+
 ForegroundObject& ExtraForegroundObject::getShadow()
 {
     return *m_shadow;
@@ -767,7 +831,7 @@ bool JumpSpringLightFlush::isEntityLanding(PhysicalEntity* entity, NGRect& bound
             entity->placeOn(itemTop);
             
             Jon *jon = nullptr;
-            if (entity->getRTTI().derivesFrom(Jon::rtti))
+            if (entity->getTypeTags() & TYPE_TAG_JON)
             {
                 jon = reinterpret_cast<Jon *>(entity);
                 jon->setGroundSoundType(getGroundSoundType());
@@ -824,6 +888,13 @@ void VerticalSaw::updateBounds()
     }
 }
 
+void VerticalSaw::resetToSnapshot(int gridX, int gridY)
+{
+    DeadlyObject::resetToSnapshot(gridX, gridY);
+    
+    m_isOnScreen = false;
+}
+
 GiantShakingTree::GiantShakingTree(int gridX, int gridY, int gridWidth, int gridHeight, ForegroundObjectType type, GroundSoundType groundSoundType, float boundsX, float boundsY, float boundsWidth, float boundsHeight) : ForegroundObject(gridX, gridY, gridWidth, gridHeight, type, groundSoundType, boundsX, boundsY, boundsWidth, boundsHeight), m_isShaking(false)
 {
     // Empty
@@ -843,6 +914,13 @@ void GiantShakingTree::update(float deltaTime)
     }
 }
 
+void GiantShakingTree::resetToSnapshot(int gridX, int gridY)
+{
+    ForegroundObject::resetToSnapshot(gridX, gridY);
+    
+    m_isShaking = false;
+}
+
 void GiantShakingTree::triggerHit()
 {
     m_isShaking = true;
@@ -872,12 +950,19 @@ void SpikeTower::updateBounds()
     bounds->setHeight(getHeight() * 0.20089285714286f);
 }
 
+void SpikeTower::resetToSnapshot(int gridX, int gridY)
+{
+    ExtraForegroundObject::resetToSnapshot(gridX, gridY);
+    
+    updateBounds();
+}
+
 bool SpikeTower::isEntityLanding(PhysicalEntity* entity, float deltaTime)
 {
     bool ret = false;
     
     Jon *jon = nullptr;
-    if (entity->getRTTI().derivesFrom(Jon::rtti))
+    if (entity->getTypeTags() & TYPE_TAG_JON)
     {
         jon = reinterpret_cast<Jon *>(entity);
         jon->getMainBounds().setAngle(jon->getAbilityState() == ABILITY_GLIDE ? 90 : 0);
@@ -904,7 +989,7 @@ bool SpikeTower::isEntityBlockedOnRight(PhysicalEntity* entity, float deltaTime)
     bool ret = false;
     
     Jon *jon = nullptr;
-    if (entity->getRTTI().derivesFrom(Jon::rtti))
+    if (entity->getTypeTags() & TYPE_TAG_JON)
     {
         jon = reinterpret_cast<Jon *>(entity);
         jon->getMainBounds().setAngle(jon->getAbilityState() == ABILITY_GLIDE ? 90 : 0);
@@ -1038,6 +1123,17 @@ bool SpikedBallRollingLeft::isEntityLanding(PhysicalEntity* entity, float deltaT
     return false;
 }
 
+void SpikedBallRollingLeft::resetToSnapshot(int gridX, int gridY)
+{
+    DeadlyObject::resetToSnapshot(gridX, gridY);
+    
+    m_isOnScreen = false;
+    m_isStopped = false;
+    m_needsToPlaySound = false;
+    m_isActivated = false;
+    m_hasFallen = false;
+}
+
 void SpikedBallRollingLeft::stop()
 {
 	m_isStopped = true;
@@ -1156,6 +1252,17 @@ bool SpikedBallRollingRight::isEntityLanding(PhysicalEntity* entity, float delta
     return false;
 }
 
+void SpikedBallRollingRight::resetToSnapshot(int gridX, int gridY)
+{
+    DeadlyObject::resetToSnapshot(gridX, gridY);
+    
+    m_isOnScreen = false;
+    m_isStopped = false;
+    m_needsToPlaySound = false;
+    m_isActivated = false;
+    m_hasFallen = false;
+}
+
 void SpikedBallRollingRight::stop()
 {
 	m_isStopped = true;
@@ -1209,6 +1316,14 @@ void SpikedBall::update(float deltaTime)
     }
 }
 
+void SpikedBall::resetToSnapshot(int gridX, int gridY)
+{
+    DeadlyObject::resetToSnapshot(gridX, gridY);
+    
+    m_isFalling = false;
+    m_hasTriggeredSnakeHit = false;
+}
+
 void SpikedBall::fall()
 {
     m_isFalling = true;
@@ -1230,6 +1345,16 @@ bool SpikedBallChain::isEntityBlockedOnRight(PhysicalEntity* entity, float delta
     return false;
 }
 
+void SpikedBallChain::resetToSnapshot(int gridX, int gridY)
+{
+    ForegroundObject::resetToSnapshot(gridX, gridY);
+    
+    // The level links the ball back up when it is entered again
+    m_spikedBall = nullptr;
+    m_isSnapping = false;
+    m_hasTriggeredSpikedBall = false;
+}
+
 void SpikedBallChain::setSpikedBall(SpikedBall* spikedBall)
 {
     m_spikedBall = spikedBall;
@@ -1403,6 +1528,21 @@ void BlockingObject::updateBounds()
     }
 }
 
+void BlockingObject::resetToSnapshot(int gridX, int gridY)
+{
+    ForegroundObject::resetToSnapshot(gridX, gridY);
+    
+    // The constructor leaves the extra bounds unplaced until the first update
+    unsigned long len = getBounds().size();
+    for (int i = 1; i < len; ++i)
+    {
+        NGRect* bounds = getBounds().at(i);
+        bounds->getLowerLeft().set(0, 0);
+        bounds->setWidth(1);
+        bounds->setHeight(1);
+    }
+}
+
 bool BlockingObject::isEntityLanding(PhysicalEntity* entity, float deltaTime)
 {
     unsigned long len = getBounds().size();
@@ -1478,12 +1618,12 @@ bool BlockingObject::isJonBlockedAbove(Jon &jon, float deltaTime)
 }
 
 RTTI_IMPL(ForegroundObject, GridLockedPhysicalEntity);
-RTTI_IMPL(PlatformObject, ForegroundObject);
-RTTI_IMPL(FloatingPlatformObject, PlatformObject);
-RTTI_IMPL(DeadlyObject, ForegroundObject);
-RTTI_IMPL(LandingDeathObject, ForegroundObject);
+RTTI_IMPL_TAG(PlatformObject, ForegroundObject, TYPE_TAG_PLATFORM);
+RTTI_IMPL_TAG(FloatingPlatformObject, PlatformObject, TYPE_TAG_ALWAYS_ACTIVE);
+RTTI_IMPL_TAG(DeadlyObject, ForegroundObject, TYPE_TAG_DEADLY);
+RTTI_IMPL_TAG(LandingDeathObject, ForegroundObject, TYPE_TAG_DEADLY);
 RTTI_IMPL(RunningIntoDeathObject, ForegroundObject);
-RTTI_IMPL(DeathFromAboveObject, ForegroundObject);
+RTTI_IMPL_TAG(DeathFromAboveObject, ForegroundObject, TYPE_TAG_DEADLY);
 RTTI_IMPL(ProvideBoostObject, ForegroundObject);
 RTTI_IMPL(EndSign, ForegroundObject);
 RTTI_IMPL(JumpSpringLightFlush, ProvideBoostObject);
@@ -1491,8 +1631,8 @@ RTTI_IMPL(VerticalSaw, DeadlyObject);
 RTTI_IMPL(GiantShakingTree, ForegroundObject);
 RTTI_IMPL(ExtraForegroundObject, ForegroundObject);
 RTTI_IMPL(SpikeTower, ExtraForegroundObject);
-RTTI_IMPL(SpikedBallRollingLeft, DeadlyObject);
-RTTI_IMPL(SpikedBallRollingRight, DeadlyObject);
+RTTI_IMPL_TAG(SpikedBallRollingLeft, DeadlyObject, TYPE_TAG_ALWAYS_ACTIVE);
+RTTI_IMPL_TAG(SpikedBallRollingRight, DeadlyObject, TYPE_TAG_ALWAYS_ACTIVE);
 RTTI_IMPL(SpikedBall, DeadlyObject);
 RTTI_IMPL(SpikedBallChain, ForegroundObject);
 RTTI_IMPL(BlockingObject, ForegroundObject);
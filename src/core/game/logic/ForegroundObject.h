@@ -30,6 +30,8 @@ public:
     
     ForegroundObject(int gridX, int gridY, int gridWidth, int gridHeight, ForegroundObjectType type, GroundSoundType groundSoundType = GROUND_SOUND_ID_NONE, float boundsX = 0, float boundsY = 0, float boundsWidth = 1, float boundsHeight = 1);
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     virtual bool isEntityLanding(PhysicalEntity* entity, float deltaTime);
 
     virtual int getEntityLandingPriority();
@@ -96,6 +98,8 @@ public:
     
     virtual void update(float deltaTime);
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     virtual bool isEntityLanding(PhysicalEntity* entity, float deltaTime);
     
     void onMoved();
@@ -177,6 +181,8 @@ public:
     
     virtual void update(float deltaTime);
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     virtual bool isEntityLanding(PhysicalEntity* entity, float deltaTime);
 
     virtual int getEntityLandingPriority();
@@ -199,6 +205,8 @@ public:
     
     virtual void update(float deltaTime);
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     ForegroundObject& getShadow();
     
 protected:
@@ -242,6 +250,8 @@ public:
     
     virtual void updateBounds();
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
 private:
     bool m_isOnScreen;
 };
@@ -255,6 +265,8 @@ public:
     
     virtual void update(float deltaTime);
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     void triggerHit();
     
 private:
@@ -270,6 +282,8 @@ public:
     
     virtual void updateBounds();
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     virtual bool isEntityLanding(PhysicalEntity* entity, float deltaTime);
     
     virtual bool isEntityBlockedOnRight(PhysicalEntity* entity, float deltaTime);
@@ -285,6 +299,8 @@ public:
     virtual void update(float deltaTime);
     
     virtual void updateBounds();
+    
+    virtual void resetToSnapshot(int gridX, int gridY);
 
     virtual bool isEntityLanding(PhysicalEntity* entity, float deltaTime);
 
@@ -308,6 +324,8 @@ public:
     virtual void update(float deltaTime);
     
     virtual void updateBounds();
+    
+    virtual void resetToSnapshot(int gridX, int gridY);
 
     virtual bool isEntityLanding(PhysicalEntity* entity, float deltaTime);
 
@@ -330,6 +348,8 @@ public:
     
     virtual void update(float deltaTime);
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     void fall();
     
 private:
@@ -344,6 +364,8 @@ class SpikedBallChain : public ForegroundObject
 public:
     SpikedBallChain(int gridX, int gridY, int gridWidth, int gridHeight, ForegroundObjectType type, GroundSoundType groundSoundType = GROUND_SOUND_ID_NONE, float boundsX = 0, float boundsY = 0, float boundsWidth = 1, float boundsHeight = 1);
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     virtual bool isEntityLanding(PhysicalEntity* entity, float deltaTime);
     
     virtual bool isEntityBlockedOnRight(PhysicalEntity* entity, float deltaTime);
@@ -375,6 +397,8 @@ public:
     
     virtual void updateBounds();
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     virtual bool isEntityLanding(PhysicalEntity* entity, float deltaTime);
     
     virtual bool isEntityBlockedOnRight(PhysicalEntity* entity, float deltaTime);
@@ -26,6 +26,13 @@
 #include "ForegroundCoverObject.h"
 #include "GameMarker.h"
 #include "NGRect.h"
+#include "SpatialHash.h"
+#include "TransformStore.h"
+#include "ActivityIndex.h"
+#include "ArenaAllocator.h"
+#include "GameSnapshot.h"
+#include "CompiledLevel.h"
+#include "LevelJsonHandler.h"
 
 #include "GameConstants.h"
 #include "EntityUtils.h"
@@ -35,36 +42,48 @@
 #include "NGSTDUtil.h"
 #include "MathUtil.h"
 
-#include "rapidjson/document.h"
+#include "rapidjson/reader.h"
 #include "rapidjson/writer.h"
 #include "rapidjson/stringbuffer.h"
 
-#define worldKey "world"
-#define levelKey "level"
-
-#define midgroundsKey "midgrounds"
-#define groundsKey "grounds"
-#define pitsKey "pits"
-#define exitGroundsKey "exitGrounds"
-#define holesKey "holes"
-#define foregroundObjectsKey "foregroundObjects"
-#define midBossForegroundObjectsKey "midBossForegroundObjects"
-#define endBossForegroundObjectsKey "endBossForegroundObjects"
-#define countHissWithMinasKey "countHissWithMinas"
-#define endBossSnakesKey "endBossSnakes"
-#define enemiesKey "enemies"
-#define collectiblesKey "collectibles"
-#define jonsKey "jons"
-#define extraForegroundObjectsKey "extraForegroundObjects"
-#define foregroundCoverObjectsKey "foregroundCoverObjects"
-#define markersKey "markers"
-
 Game::Game() :
+m_cameraBounds(nullptr),
+m_groundsSpatialHash(new SpatialHash()),
+m_pitsSpatialHash(new SpatialHash()),
+m_exitGroundsSpatialHash(new SpatialHash()),
+m_holesSpatialHash(new SpatialHash()),
+m_foregroundObjectsSpatialHash(new SpatialHash()),
+m_midBossForegroundObjectsSpatialHash(new SpatialHash()),
+m_endBossForegroundObjectsSpatialHash(new SpatialHash()),
+m_extraForegroundObjectsSpatialHash(new SpatialHash()),
+m_foregroundCoverObjectsSpatialHash(new SpatialHash()),
+m_enemiesTransformStore(new TransformStore()),
+m_collectibleItemsTransformStore(new TransformStore()),
+m_midgroundsActivityIndex(new ActivityIndex()),
+m_groundsActivityIndex(new ActivityIndex()),
+m_pitsActivityIndex(new ActivityIndex()),
+m_exitGroundsActivityIndex(new ActivityIndex()),
+m_holesActivityIndex(new ActivityIndex()),
+m_foregroundObjectsActivityIndex(new ActivityIndex()),
+m_collectibleItemsActivityIndex(new ActivityIndex()),
+m_extraForegroundObjectsActivityIndex(new ActivityIndex()),
+m_foregroundCoverObjectsActivityIndex(new ActivityIndex()),
+m_markersActivityIndex(new ActivityIndex()),
+m_jonContactBounds(new NGRect(0, 0, 1, 1)),
+m_arena(new ArenaAllocator()),
+m_queryRegion(new NGRect(0, 0, 1, 1)),
+m_snapshot(nullptr),
 m_fStateTime(0.0f),
 m_fFarRight(ZOOMED_OUT_CAM_WIDTH),
 m_fFarRightBottom(GAME_HEIGHT / 2),
 m_fCamFarRight(ZOOMED_OUT_CAM_WIDTH),
 m_fCamFarRightBottom(GAME_HEIGHT / 2),
+m_fActivityMargin(DEFAULT_ACTIVITY_MARGIN),
+m_fActivityWindowLeft(0),
+m_fActivityWindowRight(0),
+m_fJonContactVelocityX(0),
+m_fJonContactVelocityY(0),
+m_fJonContactDeltaTime(0),
 m_iBestLevelStatsFlag(0),
 m_iNumCarrotsCollected(0),
 m_iNumGoldenCarrotsCollected(0),
@@ -82,7 +101,11 @@ m_iScore(0),
 m_iWorld(1),
 m_iLevel(1),
 m_isLevelEditor(false),
-m_isAuthenticated(false)
+m_isAuthenticated(false),
+m_isActivityWindowOpen(false),
+m_isJonContactValid(false),
+m_isJonFallingThroughHole(false),
+m_isJonFallingThroughPit(false)
 {
     GRID_MANAGER->setGridCellSize(GRID_CELL_SIZE);
 }
@@ -90,15 +113,47 @@ m_isAuthenticated(false)
 Game::~Game()
 {
     reset();
+    
+    delete m_groundsSpatialHash;
+    delete m_pitsSpatialHash;
+    delete m_exitGroundsSpatialHash;
+    delete m_holesSpatialHash;
+    delete m_foregroundObjectsSpatialHash;
+    delete m_midBossForegroundObjectsSpatialHash;
+    delete m_endBossForegroundObjectsSpatialHash;
+    delete m_extraForegroundObjectsSpatialHash;
+    delete m_foregroundCoverObjectsSpatialHash;
+    
+    delete m_enemiesTransformStore;
+    delete m_collectibleItemsTransformStore;
+    
+    delete m_midgroundsActivityIndex;
+    delete m_groundsActivityIndex;
+    delete m_pitsActivityIndex;
+    delete m_exitGroundsActivityIndex;
+    delete m_holesActivityIndex;
+    delete m_foregroundObjectsActivityIndex;
+    delete m_collectibleItemsActivityIndex;
+    delete m_extraForegroundObjectsActivityIndex;
+    delete m_foregroundCoverObjectsActivityIndex;
+    delete m_markersActivityIndex;
+    
+    delete m_arena;
+    
+    delete m_queryRegion;
+    delete m_jonContactBounds;
 }
 
 void Game::copy(Game* game)
 {
     reset();
     
+    ArenaAllocator* previousArena = ArenaAllocator::setCurrent(m_arena);
+    
     m_iWorld = game->getWorld();
     m_iLevel = game->getLevel();
     m_isLevelEditor = game->isLevelEditor();
+    m_fActivityMargin = game->getActivityMargin();
     
     EntityUtils::copyPhysicalEntities(game->getMidgrounds(), m_midgrounds);
     EntityUtils::copyPhysicalEntities(game->getGrounds(), m_grounds);
@@ -119,45 +174,97 @@ void Game::copy(Game* game)
     EntityUtils::copyPhysicalEntities(game->getMarkers(), m_markers);
     
     onLoaded();
+    
+    ArenaAllocator::setCurrent(previousArena);
 }
 
 void Game::load(const char* json)
 {
     reset();
     
-    rapidjson::Document d;
-    d.Parse<0>(json);
+    ArenaAllocator* previousArena = ArenaAllocator::setCurrent(m_arena);
+    
+    // Entities are created straight from the parser's events, no document is built
+    rapidjson::Reader reader;
+    rapidjson::StringStream stream(json);
+    LevelJsonHandler handler(this);
     
-    if (d.HasMember(worldKey) && d.HasMember(levelKey))
+    if (!reader.Parse<0>(stream, handler))
     {
-        rapidjson::Value& world = d[worldKey];
-        assert(world.IsInt());
-        m_iWorld = d[worldKey].GetInt();
+        // A malformed level loads empty, as it did when a document was parsed first
+        reset();
+    }
+    else if (handler.hasWorldAndLevel())
+    {
+        m_iWorld = handler.getWorld();
+        m_iLevel = handler.getLevel();
+    }
+    
+    onLoaded();
+    
+    ArenaAllocator::setCurrent(previousArena);
+}
+
+bool Game::loadCompiled(const unsigned char* data, size_t length)
+{
+    reset();
+    
+    if (!data || length < sizeof(CompiledLevelHeader))
+    {
+        return false;
+    }
+    
+    const CompiledLevelHeader* header = reinterpret_cast<const CompiledLevelHeader *>(data);
+    
+    if (header->magic != COMPILED_LEVEL_MAGIC
+        || header->version != COMPILED_LEVEL_VERSION)
+    {
+        return false;
+    }
+    
+    // Counted against what is left of the buffer so a corrupt count can't overflow the sum
+    size_t maxRecords = (length - sizeof(CompiledLevelHeader)) / sizeof(CompiledLevelRecord);
+    size_t numRecords = 0;
+    for (int i = 0; i < NUM_COMPILED_LEVEL_SECTIONS; ++i)
+    {
+        if (header->numRecords[i] > maxRecords - numRecords)
+        {
+            return false;
+        }
         
-        rapidjson::Value& level = d[levelKey];
-        assert(level.IsInt());
-        m_iLevel = d[levelKey].GetInt();
-    }
-    
-    EntityUtils::loadArray(m_midgrounds, d, midgroundsKey);
-    EntityUtils::loadArray(m_grounds, d, groundsKey);
-    EntityUtils::loadArray(m_pits, d, pitsKey);
-    EntityUtils::loadArray(m_exitGrounds, d, exitGroundsKey);
-    EntityUtils::loadArray(m_holes, d, holesKey);
-    EntityUtils::loadArray(m_foregroundObjects, d, foregroundObjectsKey);
-    EntityUtils::loadArray(m_midBossForegroundObjects, d, midBossForegroundObjectsKey);
-    EntityUtils::loadArray(m_endBossForegroundObjects, d, endBossForegroundObjectsKey);
-    EntityUtils::loadArray(m_countHissWithMinas, d, countHissWithMinasKey);
-    EntityUtils::loadArray(m_endBossSnakes, d, endBossSnakesKey);
-    EntityUtils::loadArray(m_enemies, d, enemiesKey);
-    EntityUtils::loadArray(m_collectibleItems, d, collectiblesKey);
-    EntityUtils::loadArray(m_jons, d, jonsKey);
-    EntityUtils::loadArray(m_extraForegroundObjects, d, extraForegroundObjectsKey);
-    EntityUtils::loadArray(m_foregroundCoverObjects, d, foregroundCoverObjectsKey);
-    
-    EntityUtils::loadArray(m_markers, d, markersKey);
+        numRecords += header->numRecords[i];
+    }
+    
+    ArenaAllocator* previousArena = ArenaAllocator::setCurrent(m_arena);
+    
+    m_iWorld = header->world;
+    m_iLevel = header->level;
+    
+    const CompiledLevelRecord* records = reinterpret_cast<const CompiledLevelRecord *>(data + sizeof(CompiledLevelHeader));
+    
+    records = EntityUtils::loadRecords(m_midgrounds, records, header->numRecords[CompiledLevelSection_Midgrounds]);
+    records = EntityUtils::loadRecords(m_grounds, records, header->numRecords[CompiledLevelSection_Grounds]);
+    records = EntityUtils::loadRecords(m_pits, records, header->numRecords[CompiledLevelSection_Pits]);
+    records = EntityUtils::loadRecords(m_exitGrounds, records, header->numRecords[CompiledLevelSection_ExitGrounds]);
+    records = EntityUtils::loadRecords(m_holes, records, header->numRecords[CompiledLevelSection_Holes]);
+    records = EntityUtils::loadRecords(m_foregroundObjects, records, header->numRecords[CompiledLevelSection_ForegroundObjects]);
+    records = EntityUtils::loadRecords(m_midBossForegroundObjects, records, header->numRecords[CompiledLevelSection_MidBossForegroundObjects]);
+    records = EntityUtils::loadRecords(m_endBossForegroundObjects, records, header->numRecords[CompiledLevelSection_EndBossForegroundObjects]);
+    records = EntityUtils::loadRecords(m_countHissWithMinas, records, header->numRecords[CompiledLevelSection_CountHissWithMinas]);
+    records = EntityUtils::loadRecords(m_endBossSnakes, records, header->numRecords[CompiledLevelSection_EndBossSnakes]);
+    records = EntityUtils::loadRecords(m_enemies, records, header->numRecords[CompiledLevelSection_Enemies]);
+    records = EntityUtils::loadRecords(m_collectibleItems, records, header->numRecords[CompiledLevelSection_CollectibleItems]);
+    records = EntityUtils::loadRecords(m_jons, records, header->numRecords[CompiledLevelSection_Jons]);
+    records = EntityUtils::loadRecords(m_extraForegroundObjects, records, header->numRecords[CompiledLevelSection_ExtraForegroundObjects]);
+    records = EntityUtils::loadRecords(m_foregroundCoverObjects, records, header->numRecords[CompiledLevelSection_ForegroundCoverObjects]);
+    
+    EntityUtils::loadRecords(m_markers, records, header->numRecords[CompiledLevelSection_Markers]);
     
     onLoaded();
+    
+    ArenaAllocator::setCurrent(previousArena);
+    
+    return isLoaded();
 }
 
 const char* Game::save()
@@ -202,12 +309,26 @@ const char* Game::save()
 
 void Game::reset()
 {
+    clearSpatialHashes();
+    clearTransformStores();
+    clearActivityIndexes();
+    
+    m_isJonContactValid = false;
+    
     NGSTDUtil::cleanUpVectorOfPointers(m_backgroundUppers);
     NGSTDUtil::cleanUpVectorOfPointers(m_backgroundMids);
-    NGSTDUtil::cleanUpVectorOfPointers(m_backgroundLowers);
+    NGSTDUtil::cleanUpVectorOfPointers(m_backgroundLowerBacks);
     NGSTDUtil::cleanUpVectorOfPointers(m_backgroundLowers);
     NGSTDUtil::cleanUpVectorOfPointers(m_backgroundMidgroundCovers);
     
+    if (m_snapshot)
+    {
+        // Snapshot entities may be parked outside of every vector, so they are deleted through the snapshot
+        freePendingEntities();
+        freeOutsideSnapshot();
+        NGSTDUtil::cleanUpVectorOfPointers(m_snapshot->entities);
+    }
+    
     NGSTDUtil::cleanUpVectorOfPointers(m_midgrounds);
     NGSTDUtil::cleanUpVectorOfPointers(m_grounds);
     NGSTDUtil::cleanUpVectorOfPointers(m_pits);
@@ -226,22 +347,134 @@ void Game::reset()
     
     NGSTDUtil::cleanUpVectorOfPointers(m_markers);
     
-    m_unlockedAchievementsKeys.clear();
+    freePendingEntities();
     
-    m_fStateTime = 0;
-    m_iNumCarrotsCollected = 0;
-    m_iNumGoldenCarrotsCollected = 0;
-    m_iNumVialsCollected = 0;
-    m_iNumCarrots = 0;
-    m_iNumGoldenCarrots = 0;
-    m_iNumVials = 0;
-    m_iNumEnemies = 0;
-    m_iScoreFromTime = 0;
-    m_iScoreFromCarrots = 0;
-    m_iScoreFromGoldenCarrots = 0;
-    m_iScoreFromVials = 0;
-    m_iScoreFromEnemies = 0;
-    m_iScore = 0;
+    delete m_snapshot;
+    m_snapshot = nullptr;
+    
+    // Every entity and its bounds are gone, so the chunks they lived in can go back in one go
+    m_arena->reset();
+    
+    resetStats();
+}
+
+void Game::takeSnapshot()
+{
+    if (!m_snapshot)
+    {
+        m_snapshot = new GameSnapshot();
+    }
+    
+    EntityUtils::takeSnapshot(m_midgrounds, m_snapshot->midgrounds);
+    EntityUtils::takeSnapshot(m_grounds, m_snapshot->grounds);
+    EntityUtils::takeSnapshot(m_pits, m_snapshot->pits);
+    EntityUtils::takeSnapshot(m_exitGrounds, m_snapshot->exitGrounds);
+    EntityUtils::takeSnapshot(m_holes, m_snapshot->holes);
+    EntityUtils::takeSnapshot(m_foregroundObjects, m_snapshot->foregroundObjects);
+    EntityUtils::takeSnapshot(m_midBossForegroundObjects, m_snapshot->midBossForegroundObjects);
+    EntityUtils::takeSnapshot(m_endBossForegroundObjects, m_snapshot->endBossForegroundObjects);
+    EntityUtils::takeSnapshot(m_countHissWithMinas, m_snapshot->countHissWithMinas);
+    EntityUtils::takeSnapshot(m_endBossSnakes, m_snapshot->endBossSnakes);
+    EntityUtils::takeSnapshot(m_enemies, m_snapshot->enemies);
+    EntityUtils::takeSnapshot(m_collectibleItems, m_snapshot->collectibleItems);
+    EntityUtils::takeSnapshot(m_jons, m_snapshot->jons);
+    EntityUtils::takeSnapshot(m_extraForegroundObjects, m_snapshot->extraForegroundObjects);
+    EntityUtils::takeSnapshot(m_foregroundCoverObjects, m_snapshot->foregroundCoverObjects);
+    
+    EntityUtils::takeSnapshot(m_markers, m_snapshot->markers);
+    
+    // Entities parked for the previous snapshot that didn't make it into this one can go
+    freePendingEntities();
+    
+    std::vector<GridLockedPhysicalEntity *> previousEntities;
+    previousEntities.swap(m_snapshot->entities);
+    
+    EntityUtils::addAll(m_midgrounds, m_snapshot->entities);
+    EntityUtils::addAll(m_grounds, m_snapshot->entities);
+    EntityUtils::addAll(m_pits, m_snapshot->entities);
+    EntityUtils::addAll(m_exitGrounds, m_snapshot->entities);
+    EntityUtils::addAll(m_holes, m_snapshot->entities);
+    EntityUtils::addAll(m_foregroundObjects, m_snapshot->entities);
+    EntityUtils::addAll(m_midBossForegroundObjects, m_snapshot->entities);
+    EntityUtils::addAll(m_endBossForegroundObjects, m_snapshot->entities);
+    EntityUtils::addAll(m_countHissWithMinas, m_snapshot->entities);
+    EntityUtils::addAll(m_endBossSnakes, m_snapshot->entities);
+    EntityUtils::addAll(m_enemies, m_snapshot->entities);
+    EntityUtils::addAll(m_collectibleItems, m_snapshot->entities);
+    EntityUtils::addAll(m_jons, m_snapshot->entities);
+    EntityUtils::addAll(m_extraForegroundObjects, m_snapshot->entities);
+    EntityUtils::addAll(m_foregroundCoverObjects, m_snapshot->entities);
+    
+    EntityUtils::addAll(m_markers, m_snapshot->entities);
+    
+    std::sort(m_snapshot->entities.begin(), m_snapshot->entities.end());
+    
+    for (std::vector<GridLockedPhysicalEntity *>::iterator i = previousEntities.begin(); i != previousEntities.end(); ++i)
+    {
+        if (!std::binary_search(m_snapshot->entities.begin(), m_snapshot->entities.end(), *i))
+        {
+            delete *i;
+        }
+    }
+}
+
+void Game::restoreSnapshot()
+{
+    assert(m_snapshot);
+    
+    resetStats();
+    
+    // Entities that aren't part of the snapshot are deleted below, the hashes would otherwise keep pointers to them
+    clearSpatialHashes();
+    clearTransformStores();
+    clearActivityIndexes();
+    
+    m_isJonContactValid = false;
+    
+    ArenaAllocator* previousArena = ArenaAllocator::setCurrent(m_arena);
+    
+    freePendingEntities();
+    freeOutsideSnapshot();
+    
+    // Every snapshot entity is reset in place, in the order they were loaded, since collectibles draw their bob from a running seed
+    EntityUtils::restoreSnapshot(m_midgrounds, m_snapshot->midgrounds);
+    EntityUtils::restoreSnapshot(m_grounds, m_snapshot->grounds);
+    EntityUtils::restoreSnapshot(m_pits, m_snapshot->pits);
+    EntityUtils::restoreSnapshot(m_exitGrounds, m_snapshot->exitGrounds);
+    EntityUtils::restoreSnapshot(m_holes, m_snapshot->holes);
+    EntityUtils::restoreSnapshot(m_foregroundObjects, m_snapshot->foregroundObjects);
+    EntityUtils::restoreSnapshot(m_midBossForegroundObjects, m_snapshot->midBossForegroundObjects);
+    EntityUtils::restoreSnapshot(m_endBossForegroundObjects, m_snapshot->endBossForegroundObjects);
+    EntityUtils::restoreSnapshot(m_countHissWithMinas, m_snapshot->countHissWithMinas);
+    EntityUtils::restoreSnapshot(m_endBossSnakes, m_snapshot->endBossSnakes);
+    EntityUtils::restoreSnapshot(m_enemies, m_snapshot->enemies);
+    EntityUtils::restoreSnapshot(m_collectibleItems, m_snapshot->collectibleItems);
+    EntityUtils::restoreSnapshot(m_jons, m_snapshot->jons);
+    EntityUtils::restoreSnapshot(m_extraForegroundObjects, m_snapshot->extraForegroundObjects);
+    EntityUtils::restoreSnapshot(m_foregroundCoverObjects, m_snapshot->foregroundCoverObjects);
+    
+    EntityUtils::restoreSnapshot(m_markers, m_snapshot->markers);
+    
+    onLoaded();
+    
+    ArenaAllocator::setCurrent(previousArena);
+}
+
+bool Game::hasSnapshot()
+{
+    return m_snapshot != nullptr;
+}
+
+void Game::release(Entity* entity)
+{
+    m_pendingFrees.push_back(entity);
+}
+
+void Game::onEntitiesReordered()
+{
+    clearSpatialHashes();
+    clearTransformStores();
+    clearActivityIndexes();
 }
 
 void Game::update(float deltaTime)
@@ -253,38 +486,57 @@ void Game::updateAndClean(float deltaTime, bool onlyJonCollectiblesAndCountHiss)
 {
     if (onlyJonCollectiblesAndCountHiss)
     {
-        EntityUtils::updateAndClean(getCountHissWithMinas(), deltaTime);
-        EntityUtils::updateAndClean(getCollectibleItems(), deltaTime);
+        EntityUtils::updateAndClean(getCountHissWithMinas(), deltaTime, &m_pendingFrees);
+        
+        m_collectibleItemsActivityIndex->wakeAll();
+        EntityUtils::updateAndClean(getCollectibleItems(), deltaTime, &m_pendingFrees);
+        
+        m_collectibleItemsTransformStore->sync(m_collectibleItems);
         
         if (getJons().size() > 0)
         {
             getJon().update(deltaTime);
         }
         
+        freePendingEntities();
+        
         return;
     }
     
-    EntityUtils::updateAndClean(getMidgrounds(), deltaTime);
-    EntityUtils::updateAndClean(getGrounds(), deltaTime);
-    EntityUtils::updateAndClean(getPits(), deltaTime);
-    EntityUtils::updateAndClean(getExitGrounds(), deltaTime);
-    EntityUtils::updateAndClean(getHoles(), deltaTime);
-    EntityUtils::updateAndClean(getForegroundObjects(), deltaTime);
-    EntityUtils::updateAndClean(getMidBossForegroundObjects(), deltaTime);
-    EntityUtils::updateAndClean(getEndBossForegroundObjects(), deltaTime);
-    EntityUtils::updateAndClean(getCountHissWithMinas(), deltaTime);
-    EntityUtils::updateAndClean(getEndBossSnakes(), deltaTime);
-    EntityUtils::updateAndClean(getEnemies(), deltaTime);
-    EntityUtils::updateAndClean(getCollectibleItems(), deltaTime);
-    EntityUtils::updateAndClean(getExtraForegroundObjects(), deltaTime);
-    EntityUtils::updateAndClean(getForegroundCoverObjects(), deltaTime);
+    // Holes are about to update their covers
+    m_isJonContactValid = false;
+    
+    openActivityWindow();
+    
+    // Bosses, Count Hiss, and enemies roam or react to Jon from afar, so they always simulate
+    updateAndCleanActive(getMidgrounds(), m_midgroundsActivityIndex, deltaTime);
+    updateAndCleanActive(getGrounds(), m_groundsActivityIndex, deltaTime);
+    updateAndCleanActive(getPits(), m_pitsActivityIndex, deltaTime);
+    updateAndCleanActive(getExitGrounds(), m_exitGroundsActivityIndex, deltaTime);
+    updateAndCleanActive(getHoles(), m_holesActivityIndex, deltaTime);
+    updateAndCleanActive(getForegroundObjects(), m_foregroundObjectsActivityIndex, deltaTime);
+    EntityUtils::updateAndClean(getMidBossForegroundObjects(), deltaTime, &m_pendingFrees);
+    EntityUtils::updateAndClean(getEndBossForegroundObjects(), deltaTime, &m_pendingFrees);
+    EntityUtils::updateAndClean(getCountHissWithMinas(), deltaTime, &m_pendingFrees);
+    EntityUtils::updateAndClean(getEndBossSnakes(), deltaTime, &m_pendingFrees);
+    EntityUtils::updateAndClean(getEnemies(), deltaTime, &m_pendingFrees);
+    updateAndCleanActive(getCollectibleItems(), m_collectibleItemsActivityIndex, deltaTime);
+    updateAndCleanActive(getExtraForegroundObjects(), m_extraForegroundObjectsActivityIndex, deltaTime);
+    updateAndCleanActive(getForegroundCoverObjects(), m_foregroundCoverObjectsActivityIndex, deltaTime);
     
-    EntityUtils::updateAndClean(getMarkers(), deltaTime);
+    updateAndCleanActive(getMarkers(), m_markersActivityIndex, deltaTime);
+    
+    // Jon's collision checks below only look at these copies, enemies don't move again this frame
+    m_enemiesTransformStore->sync(m_enemies);
+    m_collectibleItemsTransformStore->sync(m_collectibleItems);
     
 	if (getJons().size() > 0)
 	{
 		getJon().update(deltaTime);
 	}
+    
+    // Nothing deleted this tick is freed until everything, Jon included, has updated
+    freePendingEntities();
 }
 
 void Game::updateBackgrounds(Vector2D& cameraPosition, float deltaTime)
@@ -323,106 +575,123 @@ int Game::calcSum()
 
 bool Game::isEntityGrounded(PhysicalEntity* entity, float deltaTime)
 {
-    if (EntityUtils::isFallingThroughHole(entity, getHoles(), deltaTime))
+    updateQueryRegion(entity, deltaTime);
+    
+    bool isJon = entity == getJonP();
+    if (isJon)
     {
-        return EntityUtils::isLanding(entity, getForegroundObjects(), deltaTime)
-        || EntityUtils::isLanding(entity, getForegroundCoverObjects(), deltaTime);
+        updateJonContacts(deltaTime);
+    }
+    
+    if (isJon ? m_isJonFallingThroughHole : EntityUtils::isFallingThroughHole(entity, getNearbyHoles(), deltaTime))
+    {
+        return EntityUtils::isLanding(entity, getNearbyForegroundObjects(), deltaTime)
+        || EntityUtils::isLanding(entity, getNearbyForegroundCoverObjects(), deltaTime);
     }
 
-	if (EntityUtils::isFallingThroughPit(entity, getPits(), deltaTime))
+	if (isJon ? m_isJonFallingThroughPit : EntityUtils::isFallingThroughPit(entity, getNearbyPits(), deltaTime))
 	{
-		return EntityUtils::isLanding(entity, getPits(), deltaTime)
-        || EntityUtils::isLanding(entity, getForegroundObjects(), deltaTime)
-        || EntityUtils::isLanding(entity, getExtraForegroundObjects(), deltaTime)
-        || EntityUtils::isLanding(entity, getMidBossForegroundObjects(), deltaTime)
-        || EntityUtils::isLanding(entity, getEndBossForegroundObjects(), deltaTime)
-        || EntityUtils::isLanding(entity, getForegroundCoverObjects(), deltaTime)
-        || EntityUtils::isLanding(entity, getEnemies(), deltaTime);
+		return EntityUtils::isLanding(entity, isJon ? m_jonNearbyPits : getNearbyPits(), deltaTime)
+        || EntityUtils::isLanding(entity, getNearbyForegroundObjects(), deltaTime)
+        || EntityUtils::isLanding(entity, getNearbyExtraForegroundObjects(), deltaTime)
+        || EntityUtils::isLanding(entity, getNearbyMidBossForegroundObjects(), deltaTime)
+        || EntityUtils::isLanding(entity, getNearbyEndBossForegroundObjects(), deltaTime)
+        || EntityUtils::isLanding(entity, getNearbyForegroundCoverObjects(), deltaTime)
+        || EntityUtils::isLanding(entity, getNearbyEnemies(), deltaTime);
 	}
     
-    return EntityUtils::isLanding(entity, getForegroundObjects(), deltaTime)
-    || EntityUtils::isLanding(entity, getExtraForegroundObjects(), deltaTime)
-    || EntityUtils::isLanding(entity, getMidBossForegroundObjects(), deltaTime)
-    || EntityUtils::isLanding(entity, getEndBossForegroundObjects(), deltaTime)
-    || EntityUtils::isLanding(entity, getForegroundCoverObjects(), deltaTime)
-    || EntityUtils::isLanding(entity, getEnemies(), deltaTime)
+    return EntityUtils::isLanding(entity, getNearbyForegroundObjects(), deltaTime)
+    || EntityUtils::isLanding(entity, getNearbyExtraForegroundObjects(), deltaTime)
+    || EntityUtils::isLanding(entity, getNearbyMidBossForegroundObjects(), deltaTime)
+    || EntityUtils::isLanding(entity, getNearbyEndBossForegroundObjects(), deltaTime)
+    || EntityUtils::isLanding(entity, getNearbyForegroundCoverObjects(), deltaTime)
+    || EntityUtils::isLanding(entity, getNearbyEnemies(), deltaTime)
     || EntityUtils::isLanding(entity, getEndBossSnakes(), deltaTime)
-    || EntityUtils::isLanding(entity, getExitGrounds(), deltaTime)
-    || EntityUtils::isLanding(entity, getGrounds(), deltaTime);
+    || EntityUtils::isLanding(entity, getNearbyExitGrounds(), deltaTime)
+    || EntityUtils::isLanding(entity, getNearbyGrounds(), deltaTime);
 }
 
 bool Game::shouldJonGrabLedge(float deltaTime)
 {
-    if (EntityUtils::isFallingThroughHole(getJonP(), getHoles(), deltaTime))
+    updateQueryRegion(getJonP(), deltaTime);
+    updateJonContacts(deltaTime);
+    
+    if (m_isJonFallingThroughHole)
     {
-        return EntityUtils::shouldJonGrabLedge(getJonP(), getForegroundObjects(), deltaTime)
-        || EntityUtils::shouldJonGrabLedge(getJonP(), getForegroundCoverObjects(), deltaTime);
+        return EntityUtils::shouldJonGrabLedge(getJonP(), getNearbyForegroundObjects(), deltaTime)
+        || EntityUtils::shouldJonGrabLedge(getJonP(), getNearbyForegroundCoverObjects(), deltaTime);
     }
     
-    if (EntityUtils::isFallingThroughPit(getJonP(), getPits(), deltaTime))
+    if (m_isJonFallingThroughPit)
     {
-        return EntityUtils::shouldJonGrabLedge(getJonP(), getPits(), deltaTime)
-        || EntityUtils::shouldJonGrabLedge(getJonP(), getForegroundObjects(), deltaTime)
-        || EntityUtils::shouldJonGrabLedge(getJonP(), getForegroundCoverObjects(), deltaTime);
+        return EntityUtils::shouldJonGrabLedge(getJonP(), m_jonNearbyPits, deltaTime)
+        || EntityUtils::shouldJonGrabLedge(getJonP(), getNearbyForegroundObjects(), deltaTime)
+        || EntityUtils::shouldJonGrabLedge(getJonP(), getNearbyForegroundCoverObjects(), deltaTime);
     }
     
-    return EntityUtils::shouldJonGrabLedge(getJonP(), getGrounds(), deltaTime)
-    || EntityUtils::shouldJonGrabLedge(getJonP(), getForegroundObjects(), deltaTime)
-    || EntityUtils::shouldJonGrabLedge(getJonP(), getForegroundCoverObjects(), deltaTime);
+    return EntityUtils::shouldJonGrabLedge(getJonP(), getNearbyGrounds(), deltaTime)
+    || EntityUtils::shouldJonGrabLedge(getJonP(), getNearbyForegroundObjects(), deltaTime)
+    || EntityUtils::shouldJonGrabLedge(getJonP(), getNearbyForegroundCoverObjects(), deltaTime);
 }
 
 bool Game::isJonBlockedOnRight(float deltaTime)
 {
-    if (EntityUtils::isFallingThroughHole(getJonP(), getHoles(), deltaTime))
+    updateQueryRegion(getJonP(), deltaTime);
+    updateJonContacts(deltaTime);
+    
+    if (m_isJonFallingThroughHole)
     {
-        return EntityUtils::isBlockedOnRight(getJonP(), getForegroundObjects(), deltaTime)
-        || EntityUtils::isBlockedOnRight(getJonP(), getForegroundCoverObjects(), deltaTime);
+        return EntityUtils::isBlockedOnRight(getJonP(), getNearbyForegroundObjects(), deltaTime)
+        || EntityUtils::isBlockedOnRight(getJonP(), getNearbyForegroundCoverObjects(), deltaTime);
     }
     
-    if (EntityUtils::isFallingThroughPit(getJonP(), getPits(), deltaTime))
+    if (m_isJonFallingThroughPit)
     {
-        return EntityUtils::isBlockedOnRight(getJonP(), getPits(), deltaTime)
-        || EntityUtils::isBlockedOnRight(getJonP(), getForegroundObjects(), deltaTime)
-        || EntityUtils::isBlockedOnRight(getJonP(), getExtraForegroundObjects(), deltaTime)
-        || EntityUtils::isBlockedOnRight(getJonP(), getMidBossForegroundObjects(), deltaTime)
-        || EntityUtils::isBlockedOnRight(getJonP(), getEndBossForegroundObjects(), deltaTime)
-        || EntityUtils::isBlockedOnRight(getJonP(), getForegroundCoverObjects(), deltaTime);
+        return EntityUtils::isBlockedOnRight(getJonP(), m_jonNearbyPits, deltaTime)
+        || EntityUtils::isBlockedOnRight(getJonP(), getNearbyForegroundObjects(), deltaTime)
+        || EntityUtils::isBlockedOnRight(getJonP(), getNearbyExtraForegroundObjects(), deltaTime)
+        || EntityUtils::isBlockedOnRight(getJonP(), getNearbyMidBossForegroundObjects(), deltaTime)
+        || EntityUtils::isBlockedOnRight(getJonP(), getNearbyEndBossForegroundObjects(), deltaTime)
+        || EntityUtils::isBlockedOnRight(getJonP(), getNearbyForegroundCoverObjects(), deltaTime);
     }
     
-    return EntityUtils::isBlockedOnRight(getJonP(), getGrounds(), deltaTime)
-    || EntityUtils::isBlockedOnRight(getJonP(), getForegroundObjects(), deltaTime)
-    || EntityUtils::isBlockedOnRight(getJonP(), getExtraForegroundObjects(), deltaTime)
-    || EntityUtils::isBlockedOnRight(getJonP(), getMidBossForegroundObjects(), deltaTime)
-    || EntityUtils::isBlockedOnRight(getJonP(), getEndBossForegroundObjects(), deltaTime)
-    || EntityUtils::isBlockedOnRight(getJonP(), getForegroundCoverObjects(), deltaTime);
+    return EntityUtils::isBlockedOnRight(getJonP(), getNearbyGrounds(), deltaTime)
+    || EntityUtils::isBlockedOnRight(getJonP(), getNearbyForegroundObjects(), deltaTime)
+    || EntityUtils::isBlockedOnRight(getJonP(), getNearbyExtraForegroundObjects(), deltaTime)
+    || EntityUtils::isBlockedOnRight(getJonP(), getNearbyMidBossForegroundObjects(), deltaTime)
+    || EntityUtils::isBlockedOnRight(getJonP(), getNearbyEndBossForegroundObjects(), deltaTime)
+    || EntityUtils::isBlockedOnRight(getJonP(), getNearbyForegroundCoverObjects(), deltaTime);
 }
 
 bool Game::isJonBlockedOnLeft(float deltaTime)
 {
 	if (getJon().getVelocity().getX() < 0)
 	{
-        if (EntityUtils::isFallingThroughHole(getJonP(), getHoles(), deltaTime))
+        updateQueryRegion(getJonP(), deltaTime);
+        updateJonContacts(deltaTime);
+        
+        if (m_isJonFallingThroughHole)
         {
-            return EntityUtils::isBlockedOnLeft(getJonP(), getForegroundObjects(), deltaTime)
-            || EntityUtils::isBlockedOnLeft(getJonP(), getForegroundCoverObjects(), deltaTime);
+            return EntityUtils::isBlockedOnLeft(getJonP(), getNearbyForegroundObjects(), deltaTime)
+            || EntityUtils::isBlockedOnLeft(getJonP(), getNearbyForegroundCoverObjects(), deltaTime);
         }
         
-        if (EntityUtils::isFallingThroughPit(getJonP(), getPits(), deltaTime))
+        if (m_isJonFallingThroughPit)
         {
-            return EntityUtils::isBlockedOnLeft(getJonP(), getPits(), deltaTime)
-            || EntityUtils::isBlockedOnLeft(getJonP(), getForegroundObjects(), deltaTime)
-            || EntityUtils::isBlockedOnLeft(getJonP(), getExtraForegroundObjects(), deltaTime)
-            || EntityUtils::isBlockedOnLeft(getJonP(), getMidBossForegroundObjects(), deltaTime)
-            || EntityUtils::isBlockedOnLeft(getJonP(), getEndBossForegroundObjects(), deltaTime)
-            || EntityUtils::isBlockedOnLeft(getJonP(), getForegroundCoverObjects(), deltaTime);
+            return EntityUtils::isBlockedOnLeft(getJonP(), m_jonNearbyPits, deltaTime)
+            || EntityUtils::isBlockedOnLeft(getJonP(), getNearbyForegroundObjects(), deltaTime)
+            || EntityUtils::isBlockedOnLeft(getJonP(), getNearbyExtraForegroundObjects(), deltaTime)
+            || EntityUtils::isBlockedOnLeft(getJonP(), getNearbyMidBossForegroundObjects(), deltaTime)
+            || EntityUtils::isBlockedOnLeft(getJonP(), getNearbyEndBossForegroundObjects(), deltaTime)
+            || EntityUtils::isBlockedOnLeft(getJonP(), getNearbyForegroundCoverObjects(), deltaTime);
         }
         
-        return EntityUtils::isBlockedOnLeft(getJonP(), getGrounds(), deltaTime)
-        || EntityUtils::isBlockedOnLeft(getJonP(), getForegroundObjects(), deltaTime)
-        || EntityUtils::isBlockedOnLeft(getJonP(), getExtraForegroundObjects(), deltaTime)
-        || EntityUtils::isBlockedOnLeft(getJonP(), getMidBossForegroundObjects(), deltaTime)
-        || EntityUtils::isBlockedOnLeft(getJonP(), getEndBossForegroundObjects(), deltaTime)
-        || EntityUtils::isBlockedOnLeft(getJonP(), getForegroundCoverObjects(), deltaTime);
+        return EntityUtils::isBlockedOnLeft(getJonP(), getNearbyGrounds(), deltaTime)
+        || EntityUtils::isBlockedOnLeft(getJonP(), getNearbyForegroundObjects(), deltaTime)
+        || EntityUtils::isBlockedOnLeft(getJonP(), getNearbyExtraForegroundObjects(), deltaTime)
+        || EntityUtils::isBlockedOnLeft(getJonP(), getNearbyMidBossForegroundObjects(), deltaTime)
+        || EntityUtils::isBlockedOnLeft(getJonP(), getNearbyEndBossForegroundObjects(), deltaTime)
+        || EntityUtils::isBlockedOnLeft(getJonP(), getNearbyForegroundCoverObjects(), deltaTime);
 	}
     
     return false;
@@ -430,27 +699,35 @@ bool Game::isJonBlockedOnLeft(float deltaTime)
 
 bool Game::isJonBlockedVertically(float deltaTime)
 {
-    if (EntityUtils::isFallingThroughPit(getJonP(), getPits(), deltaTime))
+    updateQueryRegion(getJonP(), deltaTime);
+    updateJonContacts(deltaTime);
+    
+    if (m_isJonFallingThroughPit)
     {
-        return EntityUtils::isBlockedAbove(getJon(), getPits(), deltaTime);
+        return EntityUtils::isBlockedAbove(getJon(), m_jonNearbyPits, deltaTime);
     }
     
-    return EntityUtils::isBlockedAbove(getJon(), getGrounds(), deltaTime)
-    || EntityUtils::isBlockedAbove(getJon(), getExitGrounds(), deltaTime)
-    || EntityUtils::isBlockedAbove(getJon(), getForegroundObjects(), deltaTime)
-    || EntityUtils::isBlockedAbove(getJon(), getExtraForegroundObjects(), deltaTime)
-    || EntityUtils::isBlockedAbove(getJon(), getMidBossForegroundObjects(), deltaTime)
-    || EntityUtils::isBlockedAbove(getJon(), getEndBossForegroundObjects(), deltaTime)
-    || EntityUtils::isBlockedAbove(getJon(), getForegroundCoverObjects(), deltaTime)
-    || EntityUtils::isBlockedAbove(getJon(), getEnemies(), deltaTime);
+    return EntityUtils::isBlockedAbove(getJon(), getNearbyGrounds(), deltaTime)
+    || EntityUtils::isBlockedAbove(getJon(), getNearbyExitGrounds(), deltaTime)
+    || EntityUtils::isBlockedAbove(getJon(), getNearbyForegroundObjects(), deltaTime)
+    || EntityUtils::isBlockedAbove(getJon(), getNearbyExtraForegroundObjects(), deltaTime)
+    || EntityUtils::isBlockedAbove(getJon(), getNearbyMidBossForegroundObjects(), deltaTime)
+    || EntityUtils::isBlockedAbove(getJon(), getNearbyEndBossForegroundObjects(), deltaTime)
+    || EntityUtils::isBlockedAbove(getJon(), getNearbyForegroundCoverObjects(), deltaTime)
+    || EntityUtils::isBlockedAbove(getJon(), getNearbyEnemies(), deltaTime);
 }
 
 bool Game::isBurrowEffective(float deltaTime)
 {
+    updateQueryRegion(getJonP(), deltaTime);
+    
 	float originalY = getJon().getPosition().getY();
 
-    bool ret = EntityUtils::isLanding(getJonP(), getGrounds(), deltaTime)
-		&& EntityUtils::isBurrowingThroughHole(getJon(), getHoles());
+    bool ret = EntityUtils::isLanding(getJonP(), getNearbyGrounds(), deltaTime)
+		&& EntityUtils::isBurrowingThroughHole(getJon(), getNearbyHoles());
+    
+    // Burrowing breaks hole covers
+    m_isJonContactValid = false;
 
 	getJon().getPosition().setY(originalY);
 
@@ -459,17 +736,28 @@ bool Game::isBurrowEffective(float deltaTime)
 
 bool Game::isUpwardThrustEffective(float deltaTime)
 {
-    return EntityUtils::isHorizontallyHitting(getJon(), getEnemies(), deltaTime)
-    || EntityUtils::isHittingFromBelow(getJon(), getEnemies(), deltaTime)
-    || EntityUtils::isHittingFromBelow(getJon(), getForegroundObjects(), deltaTime)
-    || EntityUtils::isHittingFromBelow(getJon(), getExtraForegroundObjects(), deltaTime)
-    || EntityUtils::isHittingFromBelow(getJon(), getMidBossForegroundObjects(), deltaTime)
-    || EntityUtils::isHittingFromBelow(getJon(), getEndBossForegroundObjects(), deltaTime);
+    updateQueryRegion(getJonP(), deltaTime);
+    
+    return EntityUtils::isHorizontallyHitting(getJon(), getNearbyEnemies(), deltaTime)
+    || EntityUtils::isHittingFromBelow(getJon(), getNearbyEnemies(), deltaTime)
+    || EntityUtils::isHittingFromBelow(getJon(), getNearbyForegroundObjects(), deltaTime)
+    || EntityUtils::isHittingFromBelow(getJon(), getNearbyExtraForegroundObjects(), deltaTime)
+    || EntityUtils::isHittingFromBelow(getJon(), getNearbyMidBossForegroundObjects(), deltaTime)
+    || EntityUtils::isHittingFromBelow(getJon(), getNearbyEndBossForegroundObjects(), deltaTime);
 }
 
 bool Game::isDashEffective(float deltaTime)
 {
-    return EntityUtils::isHorizontallyHitting(getJon(), getEnemies(), deltaTime);
+    updateQueryRegion(getJonP(), deltaTime);
+    
+    return EntityUtils::isHorizontallyHitting(getJon(), getNearbyEnemies(), deltaTime);
+}
+
+std::vector<CollectibleItem *>& Game::getNearbyCollectibleItems(PhysicalEntity* entity)
+{
+    updateQueryRegion(entity, 0);
+    
+    return nearby(m_collectibleItems, m_collectibleItemsTransformStore, m_nearbyCollectibleItems);
 }
 
 void Game::updateScoreFromTime()
@@ -672,6 +960,16 @@ NGRect* Game::getCameraBounds()
     return m_cameraBounds;
 }
 
+void Game::setActivityMargin(float activityMargin)
+{
+    m_fActivityMargin = activityMargin;
+}
+
+float Game::getActivityMargin()
+{
+    return m_fActivityMargin;
+}
+
 float Game::getFarRight()
 {
     return m_fFarRight;
@@ -881,7 +1179,7 @@ bool Game::isAuthenticated()
 
 void Game::onLoaded()
 {
-    if (m_iWorld == 1)
+    if (m_iWorld == 1 && m_backgroundUppers.size() == 0)
     {
         int numBgs = m_isLevelEditor ? 4 : 1;
         for (int i = 0; i < numBgs; ++i)
@@ -947,6 +1245,83 @@ void Game::onLoaded()
     calcFarRight();
 }
 
+void Game::loadRecord(CompiledLevelSection section, const CompiledLevelRecord& record)
+{
+    switch (section)
+    {
+        case CompiledLevelSection_Midgrounds:
+            EntityUtils::loadRecord(m_midgrounds, record);
+            break;
+        case CompiledLevelSection_Grounds:
+            EntityUtils::loadRecord(m_grounds, record);
+            break;
+        case CompiledLevelSection_Pits:
+            EntityUtils::loadRecord(m_pits, record);
+            break;
+        case CompiledLevelSection_ExitGrounds:
+            EntityUtils::loadRecord(m_exitGrounds, record);
+            break;
+        case CompiledLevelSection_Holes:
+            EntityUtils::loadRecord(m_holes, record);
+            break;
+        case CompiledLevelSection_ForegroundObjects:
+            EntityUtils::loadRecord(m_foregroundObjects, record);
+            break;
+        case CompiledLevelSection_MidBossForegroundObjects:
+            EntityUtils::loadRecord(m_midBossForegroundObjects, record);
+            break;
+        case CompiledLevelSection_EndBossForegroundObjects:
+            EntityUtils::loadRecord(m_endBossForegroundObjects, record);
+            break;
+        case CompiledLevelSection_CountHissWithMinas:
+            EntityUtils::loadRecord(m_countHissWithMinas, record);
+            break;
+        case CompiledLevelSection_EndBossSnakes:
+            EntityUtils::loadRecord(m_endBossSnakes, record);
+            break;
+        case CompiledLevelSection_Enemies:
+            EntityUtils::loadRecord(m_enemies, record);
+            break;
+        case CompiledLevelSection_CollectibleItems:
+            EntityUtils::loadRecord(m_collectibleItems, record);
+            break;
+        case CompiledLevelSection_Jons:
+            EntityUtils::loadRecord(m_jons, record);
+            break;
+        case CompiledLevelSection_ExtraForegroundObjects:
+            EntityUtils::loadRecord(m_extraForegroundObjects, record);
+            break;
+        case CompiledLevelSection_ForegroundCoverObjects:
+            EntityUtils::loadRecord(m_foregroundCoverObjects, record);
+            break;
+        case CompiledLevelSection_Markers:
+            EntityUtils::loadRecord(m_markers, record);
+            break;
+        default:
+            break;
+    }
+}
+
+void Game::resetStats()
+{
+    m_unlockedAchievementsKeys.clear();
+    
+    m_fStateTime = 0;
+    m_iNumCarrotsCollected = 0;
+    m_iNumGoldenCarrotsCollected = 0;
+    m_iNumVialsCollected = 0;
+    m_iNumCarrots = 0;
+    m_iNumGoldenCarrots = 0;
+    m_iNumVials = 0;
+    m_iNumEnemies = 0;
+    m_iScoreFromTime = 0;
+    m_iScoreFromCarrots = 0;
+    m_iScoreFromGoldenCarrots = 0;
+    m_iScoreFromVials = 0;
+    m_iScoreFromEnemies = 0;
+    m_iScore = 0;
+}
+
 void Game::configureGoldenCarrots()
 {
     int index = 0;
@@ -959,3 +1334,258 @@ void Game::configureGoldenCarrots()
         }
     }
 }
+
+void Game::freePendingEntities()
+{
+    if (!m_snapshot)
+    {
+        NGSTDUtil::cleanUpVectorOfPointers(m_pendingFrees);
+        
+        return;
+    }
+    
+    for (std::vector<Entity *>::iterator i = m_pendingFrees.begin(); i != m_pendingFrees.end(); ++i)
+    {
+        std::vector<GridLockedPhysicalEntity *>::iterator j = std::lower_bound(m_snapshot->entities.begin(), m_snapshot->entities.end(), *i);
+        if (j != m_snapshot->entities.end() && *j == *i)
+        {
+            // Parked until the next restart puts it back
+            (*j)->removeFromSpatialHash();
+        }
+        else
+        {
+            delete *i;
+        }
+    }
+    
+    m_pendingFrees.clear();
+}
+
+void Game::freeOutsideSnapshot()
+{
+    EntityUtils::freeOutsideSnapshot(m_midgrounds, m_snapshot->entities);
+    EntityUtils::freeOutsideSnapshot(m_grounds, m_snapshot->entities);
+    EntityUtils::freeOutsideSnapshot(m_pits, m_snapshot->entities);
+    EntityUtils::freeOutsideSnapshot(m_exitGrounds, m_snapshot->entities);
+    EntityUtils::freeOutsideSnapshot(m_holes, m_snapshot->entities);
+    EntityUtils::freeOutsideSnapshot(m_foregroundObjects, m_snapshot->entities);
+    EntityUtils::freeOutsideSnapshot(m_midBossForegroundObjects, m_snapshot->entities);
+    EntityUtils::freeOutsideSnapshot(m_endBossForegroundObjects, m_snapshot->entities);
+    EntityUtils::freeOutsideSnapshot(m_countHissWithMinas, m_snapshot->entities);
+    EntityUtils::freeOutsideSnapshot(m_endBossSnakes, m_snapshot->entities);
+    EntityUtils::freeOutsideSnapshot(m_enemies, m_snapshot->entities);
+    EntityUtils::freeOutsideSnapshot(m_collectibleItems, m_snapshot->entities);
+    EntityUtils::freeOutsideSnapshot(m_jons, m_snapshot->entities);
+    EntityUtils::freeOutsideSnapshot(m_extraForegroundObjects, m_snapshot->entities);
+    EntityUtils::freeOutsideSnapshot(m_foregroundCoverObjects, m_snapshot->entities);
+    
+    EntityUtils::freeOutsideSnapshot(m_markers, m_snapshot->entities);
+}
+
+void Game::clearSpatialHashes()
+{
+    m_groundsSpatialHash->clear();
+    m_pitsSpatialHash->clear();
+    m_exitGroundsSpatialHash->clear();
+    m_holesSpatialHash->clear();
+    m_foregroundObjectsSpatialHash->clear();
+    m_midBossForegroundObjectsSpatialHash->clear();
+    m_endBossForegroundObjectsSpatialHash->clear();
+    m_extraForegroundObjectsSpatialHash->clear();
+    m_foregroundCoverObjectsSpatialHash->clear();
+}
+
+void Game::clearTransformStores()
+{
+    m_enemiesTransformStore->clear();
+    m_collectibleItemsTransformStore->clear();
+}
+
+void Game::clearActivityIndexes()
+{
+    m_midgroundsActivityIndex->clear();
+    m_groundsActivityIndex->clear();
+    m_pitsActivityIndex->clear();
+    m_exitGroundsActivityIndex->clear();
+    m_holesActivityIndex->clear();
+    m_foregroundObjectsActivityIndex->clear();
+    m_collectibleItemsActivityIndex->clear();
+    m_extraForegroundObjectsActivityIndex->clear();
+    m_foregroundCoverObjectsActivityIndex->clear();
+    m_markersActivityIndex->clear();
+}
+
+void Game::wakeActivityIndexes()
+{
+    m_midgroundsActivityIndex->wakeAll();
+    m_groundsActivityIndex->wakeAll();
+    m_pitsActivityIndex->wakeAll();
+    m_exitGroundsActivityIndex->wakeAll();
+    m_holesActivityIndex->wakeAll();
+    m_foregroundObjectsActivityIndex->wakeAll();
+    m_collectibleItemsActivityIndex->wakeAll();
+    m_extraForegroundObjectsActivityIndex->wakeAll();
+    m_foregroundCoverObjectsActivityIndex->wakeAll();
+    m_markersActivityIndex->wakeAll();
+}
+
+void Game::openActivityWindow()
+{
+    // The level editor moves entities around, so everything it shows keeps simulating
+    m_isActivityWindowOpen = m_cameraBounds && !m_isLevelEditor && m_fActivityMargin >= 0;
+    
+    if (!m_isActivityWindowOpen)
+    {
+        // Everything is about to be updated, so whatever was dormant has to catch up first
+        wakeActivityIndexes();
+        
+        // Positions may have changed while nothing was being indexed
+        clearActivityIndexes();
+        
+        return;
+    }
+    
+    m_fActivityWindowLeft = m_cameraBounds->getLeft() - m_fActivityMargin;
+    m_fActivityWindowRight = m_cameraBounds->getRight() + m_fActivityMargin;
+}
+
+template<typename T>
+void Game::updateAndCleanActive(std::vector<T *>& items, ActivityIndex* activityIndex, float deltaTime)
+{
+    if (!m_isActivityWindowOpen)
+    {
+        EntityUtils::updateAndClean(items, deltaTime, &m_pendingFrees);
+        
+        return;
+    }
+    
+    if (activityIndex->getCount() != (int) items.size())
+    {
+        // Entities were added or removed outside of the index (loading, loop markers)
+        activityIndex->rebuild(items, TYPE_TAG_ALWAYS_ACTIVE);
+    }
+    
+    activityIndex->gather(m_fActivityWindowLeft, m_fActivityWindowRight, deltaTime);
+    
+    EntityUtils::updateAndClean(items, activityIndex, deltaTime, &m_pendingFrees);
+}
+
+void Game::updateQueryRegion(PhysicalEntity* entity, float deltaTime)
+{
+    NGRect& bounds = entity->getMainBounds();
+    
+    float paddingX = fabsf(entity->getVelocity().getX() * deltaTime) + GRID_CELL_SIZE * 8;
+    float paddingY = fabsf(entity->getVelocity().getY() * deltaTime) + GRID_CELL_SIZE * 8;
+    
+    m_queryRegion->getLowerLeft().set(bounds.getLeft() - paddingX, bounds.getBottom() - paddingY);
+    m_queryRegion->setWidth(bounds.getWidth() + paddingX * 2);
+    m_queryRegion->setHeight(bounds.getHeight() + paddingY * 2);
+}
+
+void Game::updateJonContacts(float deltaTime)
+{
+    // Every Jon predicate asks whether he is falling through a hole or pit, answered once while his bounds and velocity hold still
+    Jon* jon = getJonP();
+    NGRect& bounds = jon->getMainBounds();
+    Vector2D& velocity = jon->getVelocity();
+    
+    if (m_isJonContactValid
+        && bounds.getLeft() == m_jonContactBounds->getLeft()
+        && bounds.getBottom() == m_jonContactBounds->getBottom()
+        && bounds.getWidth() == m_jonContactBounds->getWidth()
+        && bounds.getHeight() == m_jonContactBounds->getHeight()
+        && velocity.getX() == m_fJonContactVelocityX
+        && velocity.getY() == m_fJonContactVelocityY
+        && deltaTime == m_fJonContactDeltaTime)
+    {
+        return;
+    }
+    
+    // The query region is already set for Jon, so these candidates stay valid alongside the answers
+    nearby(m_pits, m_pitsSpatialHash, m_jonNearbyPits);
+    
+    m_isJonFallingThroughHole = EntityUtils::isFallingThroughHole(jon, getNearbyHoles(), deltaTime);
+    m_isJonFallingThroughPit = EntityUtils::isFallingThroughPit(jon, m_jonNearbyPits, deltaTime);
+    
+    m_jonContactBounds->getLowerLeft().set(bounds.getLeft(), bounds.getBottom());
+    m_jonContactBounds->setWidth(bounds.getWidth());
+    m_jonContactBounds->setHeight(bounds.getHeight());
+    m_fJonContactVelocityX = velocity.getX();
+    m_fJonContactVelocityY = velocity.getY();
+    m_fJonContactDeltaTime = deltaTime;
+    m_isJonContactValid = true;
+}
+
+template<typename T>
+std::vector<T *>& Game::nearby(std::vector<T *>& items, SpatialHash* spatialHash, std::vector<T *>& results)
+{
+    if (spatialHash->getCount() != (int) items.size())
+    {
+        // Entities were added or removed outside of the hash (loading, loop markers, level editor, reordering)
+        spatialHash->rebuild(items);
+    }
+    
+    return spatialHash->query(*m_queryRegion, results);
+}
+
+template<typename T>
+std::vector<T *>& Game::nearby(std::vector<T *>& items, TransformStore* transformStore, std::vector<T *>& results)
+{
+    if (transformStore->getCount() != (int) items.size())
+    {
+        // Not synced since the last load or restore
+        transformStore->sync(items);
+    }
+    
+    return transformStore->query(*m_queryRegion, results);
+}
+
+std::vector<Ground *>& Game::getNearbyGrounds()
+{
+    return nearby(m_grounds, m_groundsSpatialHash, m_nearbyGrounds);
+}
+
+std::vector<Ground *>& Game::getNearbyPits()
+{
+    return nearby(m_pits, m_pitsSpatialHash, m_nearbyPits);
+}
+
+std::vector<ExitGround *>& Game::getNearbyExitGrounds()
+{
+    return nearby(m_exitGrounds, m_exitGroundsSpatialHash, m_nearbyExitGrounds);
+}
+
+std::vector<Hole *>& Game::getNearbyHoles()
+{
+    return nearby(m_holes, m_holesSpatialHash, m_nearbyHoles);
+}
+
+std::vector<ForegroundObject *>& Game::getNearbyForegroundObjects()
+{
+    return nearby(m_foregroundObjects, m_foregroundObjectsSpatialHash, m_nearbyForegroundObjects);
+}
+
+std::vector<ForegroundObject *>& Game::getNearbyMidBossForegroundObjects()
+{
+    return nearby(m_midBossForegroundObjects, m_midBossForegroundObjectsSpatialHash, m_nearbyMidBossForegroundObjects);
+}
+
+std::vector<ForegroundObject *>& Game::getNearbyEndBossForegroundObjects()
+{
+    return nearby(m_endBossForegroundObjects, m_endBossForegroundObjectsSpatialHash, m_nearbyEndBossForegroundObjects);
+}
+
+std::vector<ExtraForegroundObject *>& Game::getNearbyExtraForegroundObjects()
+{
+    return nearby(m_extraForegroundObjects, m_extraForegroundObjectsSpatialHash, m_nearbyExtraForegroundObjects);
+}
+
+std::vector<ForegroundCoverObject *>& Game::getNearbyForegroundCoverObjects()
+{
+    return nearby(m_foregroundCoverObjects, m_foregroundCoverObjectsSpatialHash, m_nearbyForegroundCoverObjects);
+}
+
+std::vector<Enemy *>& Game::getNearbyEnemies()
+{
+    return nearby(m_enemies, m_enemiesTransformStore, m_nearbyEnemies);
+}
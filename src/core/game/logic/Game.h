@@ -10,6 +10,7 @@
 #define __nosfuratu__Game__
 
 class Vector2D;
+class Entity;
 class PhysicalEntity;
 class Background;
 class Midground;
@@ -26,12 +27,21 @@ class ExtraForegroundObject;
 class ForegroundCoverObject;
 class GameMarker;
 class NGRect;
+class SpatialHash;
+class TransformStore;
+class ActivityIndex;
+class ArenaAllocator;
+struct GameSnapshot;
+
+#include "CompiledLevel.h"
 
 #include <vector>
 #include <string>
 
 class Game
 {
+    friend class LevelJsonHandler;
+    
 public:
     Game();
     
@@ -41,10 +51,25 @@ public:
     
     void load(const char* json);
     
+    // Rejects data that isn't a compiled level of this version or is cut short, leaving the game unloaded
+    bool loadCompiled(const unsigned char* data, size_t length);
+    
     const char* save();
     
     void reset();
     
+    void takeSnapshot();
+    
+    void restoreSnapshot();
+    
+    bool hasSnapshot();
+    
+    // Call after sorting an entity vector in place, nearby queries are indexed by vector slot
+    void onEntitiesReordered();
+    
+    // For entities taken out of their vector outside of an update, snapshot ones are kept for the next restart
+    void release(Entity* entity);
+    
     void update(float deltaTime);
     
     void updateAndClean(float deltaTime, bool onlyJonCollectiblesAndCountHiss = false);
@@ -69,6 +94,8 @@ public:
     
     bool isDashEffective(float deltaTime);
     
+    std::vector<CollectibleItem *>& getNearbyCollectibleItems(PhysicalEntity* entity);
+    
     void updateScoreFromTime();
     
     void updateScore();
@@ -137,6 +164,10 @@ public:
     
     NGRect* getCameraBounds();
     
+    void setActivityMargin(float activityMargin);
+    
+    float getActivityMargin();
+    
     float getFarRight();
     
     float getFarRightBottom();
@@ -225,6 +256,45 @@ private:
     std::vector<GameMarker *> m_markers;
     NGRect* m_cameraBounds;
     
+    SpatialHash* m_groundsSpatialHash;
+    SpatialHash* m_pitsSpatialHash;
+    SpatialHash* m_exitGroundsSpatialHash;
+    SpatialHash* m_holesSpatialHash;
+    SpatialHash* m_foregroundObjectsSpatialHash;
+    SpatialHash* m_midBossForegroundObjectsSpatialHash;
+    SpatialHash* m_endBossForegroundObjectsSpatialHash;
+    SpatialHash* m_extraForegroundObjectsSpatialHash;
+    SpatialHash* m_foregroundCoverObjectsSpatialHash;
+    std::vector<Ground *> m_nearbyGrounds;
+    std::vector<Ground *> m_nearbyPits;
+    std::vector<ExitGround *> m_nearbyExitGrounds;
+    std::vector<Hole *> m_nearbyHoles;
+    std::vector<ForegroundObject *> m_nearbyForegroundObjects;
+    std::vector<ForegroundObject *> m_nearbyMidBossForegroundObjects;
+    std::vector<ForegroundObject *> m_nearbyEndBossForegroundObjects;
+    std::vector<ExtraForegroundObject *> m_nearbyExtraForegroundObjects;
+    std::vector<ForegroundCoverObject *> m_nearbyForegroundCoverObjects;
+    TransformStore* m_enemiesTransformStore;
+    TransformStore* m_collectibleItemsTransformStore;
+    std::vector<Enemy *> m_nearbyEnemies;
+    std::vector<CollectibleItem *> m_nearbyCollectibleItems;
+    ActivityIndex* m_midgroundsActivityIndex;
+    ActivityIndex* m_groundsActivityIndex;
+    ActivityIndex* m_pitsActivityIndex;
+    ActivityIndex* m_exitGroundsActivityIndex;
+    ActivityIndex* m_holesActivityIndex;
+    ActivityIndex* m_foregroundObjectsActivityIndex;
+    ActivityIndex* m_collectibleItemsActivityIndex;
+    ActivityIndex* m_extraForegroundObjectsActivityIndex;
+    ActivityIndex* m_foregroundCoverObjectsActivityIndex;
+    ActivityIndex* m_markersActivityIndex;
+    std::vector<Ground *> m_jonNearbyPits;
+    std::vector<Entity *> m_pendingFrees;
+    NGRect* m_jonContactBounds;
+    ArenaAllocator* m_arena;
+    NGRect* m_queryRegion;
+    GameSnapshot* m_snapshot;
+    
     std::vector<std::string> m_unlockedAchievementsKeys;
     
     float m_fStateTime;
@@ -232,6 +302,12 @@ private:
     float m_fFarRightBottom;
     float m_fCamFarRight;
     float m_fCamFarRightBottom;
+    float m_fActivityMargin;
+    float m_fActivityWindowLeft;
+    float m_fActivityWindowRight;
+    float m_fJonContactVelocityX;
+    float m_fJonContactVelocityY;
+    float m_fJonContactDeltaTime;
     int m_iBestLevelStatsFlag;
     int m_iNumCarrotsCollected;
     int m_iNumGoldenCarrotsCollected;
@@ -250,10 +326,65 @@ private:
     int m_iLevel;
     bool m_isLevelEditor;
     bool m_isAuthenticated;
+    bool m_isActivityWindowOpen;
+    bool m_isJonContactValid;
+    bool m_isJonFallingThroughHole;
+    bool m_isJonFallingThroughPit;
     
     void onLoaded();
     
+    void loadRecord(CompiledLevelSection section, const CompiledLevelRecord& record);
+    
+    void resetStats();
+    
     void configureGoldenCarrots();
+    
+    void freePendingEntities();
+    
+    void freeOutsideSnapshot();
+    
+    void clearSpatialHashes();
+    
+    void clearTransformStores();
+    
+    void clearActivityIndexes();
+    
+    void wakeActivityIndexes();
+    
+    void openActivityWindow();
+    
+    template<typename T>
+    void updateAndCleanActive(std::vector<T *>& items, ActivityIndex* activityIndex, float deltaTime);
+    
+    void updateQueryRegion(PhysicalEntity* entity, float deltaTime);
+    
+    void updateJonContacts(float deltaTime);
+    
+    template<typename T>
+    std::vector<T *>& nearby(std::vector<T *>& items, SpatialHash* spatialHash, std::vector<T *>& results);
+    
+    template<typename T>
+    std::vector<T *>& nearby(std::vector<T *>& items, TransformStore* transformStore, std::vector<T *>& results);
+    
+    std::vector<Ground *>& getNearbyGrounds();
+    
+    std::vector<Ground *>& getNearbyPits();
+    
+    std::vector<ExitGround *>& getNearbyExitGrounds();
+    
+    std::vector<Hole *>& getNearbyHoles();
+    
+    std::vector<ForegroundObject *>& getNearbyForegroundObjects();
+    
+    std::vector<ForegroundObject *>& getNearbyMidBossForegroundObjects();
+    
+    std::vector<ForegroundObject *>& getNearbyEndBossForegroundObjects();
+    
+    std::vector<ExtraForegroundObject *>& getNearbyExtraForegroundObjects();
+    
+    std::vector<ForegroundCoverObject *>& getNearbyForegroundCoverObjects();
+    
+    std::vector<Enemy *>& getNearbyEnemies();
 };
 
 #endif /* defined(__nosfuratu__Game__) */
@@ -260,6 +260,9 @@
 #define GRID_CELL_SIZE 0.140625f
 
 #define ZOOMED_OUT_CAM_WIDTH 63.5625f
+
+// How far past either side of the camera entities keep simulating, negative keeps everything active
+#define DEFAULT_ACTIVITY_MARGIN CAM_WIDTH
 #define GAME_HEIGHT 36.0f
 
 #define GAME_GRAVITY -18.0f
@@ -269,6 +272,10 @@
 #define VAMP_DEFAULT_MAX_SPEED 11.0f
 #define VAMP_DEFAULT_ACCELERATION 7.0f
 
+// Past these counts the oldest effect is recycled
+#define MAX_NUM_DUST_CLOUDS 32
+#define MAX_NUM_JON_AFTER_IMAGES 32
+
 #define SCORE_ENEMY 2500
 #define SCORE_CARROT 250
 #define SCORE_GOLDEN_CARROT 10000
@@ -303,6 +310,20 @@
 
 #define FLAG_CUTSCENE_VIEWED_OPENING 1
 
+//// Type Tag Definitions ////
+
+// Set through RTTI_IMPL_TAG, inherited by subclasses
+#define TYPE_TAG_JON 1
+#define TYPE_TAG_PLATFORM 2
+#define TYPE_TAG_DEADLY 4
+#define TYPE_TAG_PIT_TUNNEL 8
+// Never goes dormant outside the activity window, for anything whose path follows its own velocity,
+// since freezing it would change where it is when Jon gets there (state time alone is caught up in onWake)
+#define TYPE_TAG_ALWAYS_ACTIVE 16
+
+// Capabilities, precomputed from the entity's type when it is constructed
+#define TYPE_TAG_NO_LEDGE_GRAB 512
+
 //// Render Definitions ////
 
 #define NUM_FRAMEBUFFERS 4
@@ -0,0 +1,43 @@
+//
+//  GameSnapshot.h
+//  nosfuratu
+//
+
+#ifndef __nosfuratu__GameSnapshot__
+#define __nosfuratu__GameSnapshot__
+
+#include <vector>
+
+class GridLockedPhysicalEntity;
+
+struct EntitySnapshot
+{
+    GridLockedPhysicalEntity* entity;
+    int gridX;
+    int gridY;
+};
+
+struct GameSnapshot
+{
+    std::vector<EntitySnapshot> midgrounds;
+    std::vector<EntitySnapshot> grounds;
+    std::vector<EntitySnapshot> pits;
+    std::vector<EntitySnapshot> exitGrounds;
+    std::vector<EntitySnapshot> holes;
+    std::vector<EntitySnapshot> foregroundObjects;
+    std::vector<EntitySnapshot> midBossForegroundObjects;
+    std::vector<EntitySnapshot> endBossForegroundObjects;
+    std::vector<EntitySnapshot> countHissWithMinas;
+    std::vector<EntitySnapshot> endBossSnakes;
+    std::vector<EntitySnapshot> enemies;
+    std::vector<EntitySnapshot> collectibleItems;
+    std::vector<EntitySnapshot> jons;
+    std::vector<EntitySnapshot> extraForegroundObjects;
+    std::vector<EntitySnapshot> foregroundCoverObjects;
+    std::vector<EntitySnapshot> markers;
+    
+    // Every entity above sorted by address, they stay alive until the snapshot is dropped so restarts can reuse them
+    std::vector<GridLockedPhysicalEntity *> entities;
+};
+
+#endif /* defined(__nosfuratu__GameSnapshot__) */
@@ -15,9 +15,24 @@
 
 #include "NGRect.h"
 #include "OverlapTester.h"
+#include "GameConstants.h"
 
 #include <math.h>
 
+static int calcCapabilityTags(GroundType type)
+{
+    switch (type)
+    {
+        case GroundType_CaveDeepSmall:
+        case GroundType_CaveDeepMedium:
+        case GroundType_CaveDeepLarge:
+        case GroundType_CaveDeepEndRight:
+            return TYPE_TAG_NO_LEDGE_GRAB;
+        default:
+            return 0;
+    }
+}
+
 Ground* Ground::create(int gridX, int gridY, int type)
 {
     GroundType gt = (GroundType)type;
@@ -111,6 +126,15 @@ Ground* Ground::create(int gridX, int gridY, int type)
 
 Ground::Ground(int gridX, int gridY, int gridWidth, int gridHeight, float boundsY, float boundsWidth, float boundsHeight, GroundType type, GroundSoundType groundSoundType) : GridLockedPhysicalEntity(gridX, gridY, gridWidth, gridHeight, 0, boundsY, boundsWidth, boundsHeight), m_game(nullptr), m_type(type), m_groundSoundType(groundSoundType)
 {
+    m_iCapabilityTags = calcCapabilityTags(type);
+    
+    updateBounds();
+}
+
+void Ground::resetToSnapshot(int gridX, int gridY)
+{
+    GridLockedPhysicalEntity::resetToSnapshot(gridX, gridY);
+    
     updateBounds();
 }
 
@@ -135,7 +159,7 @@ bool Ground::isEntityLanding(PhysicalEntity* entity, float deltaTime)
                 entity->placeOn(itemTop);
                 
                 Jon *jon = nullptr;
-                if (entity->getRTTI().derivesFrom(Jon::rtti))
+                if (entity->getTypeTags() & TYPE_TAG_JON)
                 {
                     jon = reinterpret_cast<Jon *>(entity);
                     jon->setGroundSoundType(getGroundSoundType());
@@ -277,7 +301,7 @@ bool GrassPit::isEntityBlockedOnRight(PhysicalEntity* entity, float deltaTime)
 {
     for (std::vector<Ground*>::iterator i = m_game->getPits().begin(); i != m_game->getPits().end(); ++i)
     {
-        if ((*i)->getRTTI().derivesFrom(PitTunnel::rtti))
+        if ((*i)->getTypeTags() & TYPE_TAG_PIT_TUNNEL)
         {
             float itemLeft = (*i)->getMainBounds().getLeft();
             float itemRight = (*i)->getMainBounds().getRight();
@@ -329,7 +353,7 @@ bool GrassPit::isEntityBlockedOnLeft(PhysicalEntity* entity, float deltaTime)
 {
     for (std::vector<Ground*>::iterator i = m_game->getPits().begin(); i != m_game->getPits().end(); ++i)
     {
-        if ((*i)->getRTTI().derivesFrom(PitTunnel::rtti))
+        if ((*i)->getTypeTags() & TYPE_TAG_PIT_TUNNEL)
         {
             float itemLeft = (*i)->getMainBounds().getLeft();
             float itemBottom = (*i)->getMainBounds().getTop();
@@ -456,4 +480,4 @@ bool PitTunnel::canObjectBePlacedUnder()
 
 RTTI_IMPL(Ground, GridLockedPhysicalEntity);
 RTTI_IMPL(GrassPit, Ground);
-RTTI_IMPL(PitTunnel, Ground);
+RTTI_IMPL_TAG(PitTunnel, Ground, TYPE_TAG_PIT_TUNNEL);
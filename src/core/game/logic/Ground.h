@@ -28,6 +28,8 @@ public:
     
     Ground(int gridX, int gridY, int gridWidth, int gridHeight, float boundsY, float boundsWidth, float boundsHeight, GroundType type, GroundSoundType groundSoundType);
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     bool isEntityLanding(PhysicalEntity* entity, float deltaTime);
 
     virtual int getEntityLandingPriority();
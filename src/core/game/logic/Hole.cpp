@@ -37,27 +37,35 @@ Hole::Hole(int gridX, int gridY, int gridWidth, int gridHeight, HoleType type, H
     m_holeCover = new HoleCover(m_position.getX(), m_position.getY(), m_fWidth, m_fHeight, holeCoverType);
 }
 
+Hole::~Hole()
+{
+    delete m_holeCover;
+    m_holeCover = nullptr;
+}
+
 void Hole::update(float deltaTime)
 {
     PhysicalEntity::update(deltaTime);
     
-    if (m_holeCover)
+    if (hasCover())
     {
         m_holeCover->update(deltaTime);
         m_holeCover->getPosition().setX(getPosition().getX());
         m_holeCover->updateBounds();
-        
-        if (m_holeCover->isRequestingDeletion())
-        {
-            delete m_holeCover;
-            m_holeCover = nullptr;
-        }
     }
 }
 
+void Hole::resetToSnapshot(int gridX, int gridY)
+{
+    GridLockedPhysicalEntity::resetToSnapshot(gridX, gridY);
+    
+    // A broken cover is kept around so a restart can put it back
+    m_holeCover->reset(m_position.getX(), m_position.getY());
+}
+
 bool Hole::triggerBurrow()
 {
-    if (m_holeCover)
+    if (hasCover())
     {
         m_holeCover->triggerHit();
         return true;
@@ -68,12 +76,12 @@ bool Hole::triggerBurrow()
 
 bool Hole::hasCover()
 {
-    return m_holeCover ? true : false;
+    return m_holeCover && !m_holeCover->isRequestingDeletion() ? true : false;
 }
 
 bool Hole::isCoverBreaking()
 {
-    return m_holeCover && m_holeCover->isBreaking() ? true : false;
+    return hasCover() && m_holeCover->isBreaking() ? true : false;
 }
 
 HoleCover& Hole::getHoleCover()
@@ -25,8 +25,12 @@ public:
     
     Hole(int gridX, int gridY, int gridWidth, int gridHeight, HoleType type, HoleCoverType holeCoverType);
     
+    virtual ~Hole();
+    
     virtual void update(float deltaTime);
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     bool triggerBurrow();
     
     bool hasCover();
@@ -28,6 +28,17 @@ void HoleCover::update(float deltaTime)
     }
 }
 
+void HoleCover::reset(float x, float y)
+{
+    m_position.set(x, y);
+    
+    m_fStateTime = 0;
+    m_isRequestingDeletion = false;
+    m_isBreaking = false;
+    
+    updateBounds();
+}
+
 void HoleCover::triggerHit()
 {
     m_isBreaking = true;
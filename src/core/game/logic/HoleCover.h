@@ -24,6 +24,8 @@ public:
     
     virtual void update(float deltaTime);
     
+    void reset(float x, float y);
+    
     void triggerHit();
     
     HoleCoverType getType();
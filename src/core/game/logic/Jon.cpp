@@ -12,6 +12,7 @@
 
 #include "Game.h"
 #include "DustCloud.h"
+#include "EffectPool.h"
 
 #include "EntityUtils.h"
 #include "GameConstants.h"
@@ -25,6 +26,11 @@
 
 #include <math.h>
 
+static DustCloud* createDustCloud()
+{
+    return new DustCloud(0, 0, 1, 1, DustCloudType_Landing);
+}
+
 Jon* Jon::create(int gridX, int gridY, int type)
 {
 	return new Jon(gridX, gridY);
@@ -69,12 +75,14 @@ m_fLedgeTopY(0)
 	m_formStateMachine->getCurrentState()->enter(this);
     
     m_jonShadow = new JonShadow();
+    
+    m_dustClouds = new EffectPool<DustCloud>(MAX_NUM_DUST_CLOUDS, createDustCloud);
+    m_afterImages.reserve(MAX_NUM_JON_AFTER_IMAGES);
 }
 
 Jon::~Jon()
 {
-    NGSTDUtil::cleanUpVectorOfPointers(getDustClouds());
-    
+    delete m_dustClouds;
     delete m_formStateMachine;
     delete m_jonShadow;
 }
@@ -83,28 +91,27 @@ void Jon::update(float deltaTime)
 {
 	m_fDeltaTime = deltaTime;
     
-    EntityUtils::updateAndClean(getDustClouds(), deltaTime);
+    m_dustClouds->update(deltaTime);
     
     m_jonShadow->update(deltaTime);
     
-    for (std::vector<Jon *>::iterator i = m_afterImages.begin(); i != m_afterImages.end(); )
+    int numAfterImages = 0;
+    for (int i = 0; i < (int) m_afterImages.size(); ++i)
     {
-        (*i)->m_color.red -= m_fDeltaTime * 3;
-        (*i)->m_color.green -= m_fDeltaTime * 3;
-        (*i)->m_color.blue += m_fDeltaTime * 3;
-        (*i)->m_color.alpha -= m_fDeltaTime * 3;
+        JonAfterImage& afterImage = m_afterImages[i];
+        afterImage.color.red -= m_fDeltaTime * 3;
+        afterImage.color.green -= m_fDeltaTime * 3;
+        afterImage.color.blue += m_fDeltaTime * 3;
+        afterImage.color.alpha -= m_fDeltaTime * 3;
         
-        if ((*i)->m_color.alpha < 0.0)
-        {
-            delete *i;
-            i = m_afterImages.erase(i);
-        }
-        else
+        if (afterImage.color.alpha >= 0.0)
         {
-            ++i;
+            m_afterImages[numAfterImages++] = afterImage;
         }
     }
     
+    m_afterImages.resize(numAfterImages);
+    
     if (m_isConsumed)
     {
         return;
@@ -199,7 +206,7 @@ void Jon::update(float deltaTime)
 				m_velocity.setX(0);
 			}
 
-            m_dustClouds.push_back(DustCloud::create(getPosition().getX(), getPosition().getY() - getHeight() / 2, DustCloudType_Landing, fabsf(m_velocity.getY() / 12.6674061f)));
+            m_dustClouds->spawn()->init(getPosition().getX(), getPosition().getY() - getHeight() / 2, DustCloudType_Landing, fabsf(m_velocity.getY() / 12.6674061f));
 
 			if (m_groundSoundType == GROUND_SOUND_ID_GRASS)
 			{
@@ -308,6 +315,58 @@ void Jon::updateBounds()
 	lowerLeft.set(m_position.getX() - width / 2, m_position.getY() - height / 2);
 }
 
+void Jon::resetToSnapshot(int gridX, int gridY)
+{
+    GridLockedPhysicalEntity::resetToSnapshot(gridX, gridY);
+    
+    m_state = JON_ALIVE;
+    m_physicalState = PHYSICAL_GROUNDED;
+    m_actionState = ACTION_NONE;
+    m_abilityState = ABILITY_NONE;
+    m_groundSoundType = GROUND_SOUND_ID_NONE;
+    m_lastSpringBouncedOn = nullptr;
+    m_color = Color(1, 1, 1, 1);
+    m_fDeltaTime = 0;
+    m_fAbilityStateTime = 0;
+    m_fTransformStateTime = 0;
+    m_iNumTriggeredJumps = 0;
+    m_iNumRabbitJumps = 0;
+    m_iNumVampireJumps = 0;
+    m_iNumBoosts = 0;
+    m_iNumEnemiesDestroyed = 0;
+    m_iAbilityFlag = 0;
+    m_isLanding = false;
+    m_isRollLanding = false;
+    m_isRightFoot = false;
+    m_isAllowedToMove = false;
+    m_isConsumed = false;
+    m_isFatallyConsumed = false;
+    m_isIdle = false;
+    m_isUserActionPrevented = false;
+    m_isBurrowEffective = false;
+    m_shouldUseVampireFormForConsumeAnimation = false;
+    m_fFlashStateTime = 0;
+    m_isFlashing = false;
+    m_isReleasingShockwave = false;
+    m_isClimbingLedge = false;
+    m_fClearingLedgeTime = -1;
+    m_fLedgeTopY = 0;
+    
+    resetBounds(m_fWidth * 0.4f, m_fHeight * 0.8203125f);
+    
+    // Back to a rabbit without running the exit of whatever form Jon died in
+    m_formStateMachine->setCurrentState(Rabbit::getInstance());
+    m_formStateMachine->setPreviousState(nullptr);
+    m_formStateMachine->getCurrentState()->enter(this);
+    
+    m_jonShadow->getPosition().set(0, 0);
+    m_jonShadow->makeInvisible();
+    m_jonShadow->updateBounds();
+    
+    m_dustClouds->clear();
+    m_afterImages.clear();
+}
+
 void Jon::triggerTransform()
 {
 #if defined __APPLE__ && defined DEBUG
@@ -465,7 +524,7 @@ int Jon::getNumJumps()
 
 std::vector<DustCloud *>& Jon::getDustClouds()
 {
-	return m_dustClouds;
+	return m_dustClouds->getEffects();
 }
 
 JonShadow* Jon::getJonShadow()
@@ -473,11 +532,32 @@ JonShadow* Jon::getJonShadow()
     return m_jonShadow;
 }
 
-std::vector<Jon *>& Jon::getAfterImages()
+std::vector<JonAfterImage>& Jon::getAfterImages()
 {
     return m_afterImages;
 }
 
+void Jon::captureAfterImage(JonAfterImage& afterImage)
+{
+    afterImage.x = m_position.getX();
+    afterImage.y = m_position.getY();
+    afterImage.width = m_fWidth;
+    afterImage.height = m_fHeight;
+    afterImage.color = m_color;
+    afterImage.state = m_state;
+    afterImage.physicalState = m_physicalState;
+    afterImage.actionState = m_actionState;
+    afterImage.abilityState = m_abilityState;
+    afterImage.stateTime = m_fStateTime;
+    afterImage.actionStateTime = m_fActionStateTime;
+    afterImage.abilityStateTime = m_fAbilityStateTime;
+    afterImage.dyingStateTime = m_fDyingStateTime;
+    afterImage.velocityX = m_velocity.getX();
+    afterImage.velocityY = m_velocity.getY();
+    afterImage.isLanding = m_isLanding;
+    afterImage.isClimbingLedge = m_isClimbingLedge;
+}
+
 JonState Jon::getState()
 {
 	return m_state;
@@ -1040,7 +1120,7 @@ void Jon::Rabbit::triggerJump(Jon* jon)
         
 		jon->m_velocity.setY(13 - jon->m_iNumRabbitJumps * 3);
         
-        jon->m_dustClouds.push_back(DustCloud::create(jon->getPosition().getX(), jon->getPosition().getY() - jon->getHeight() / 3, DustCloudType_Kick_Up));
+        jon->m_dustClouds->spawn()->init(jon->getPosition().getX(), jon->getPosition().getY() - jon->getHeight() / 3, DustCloudType_Kick_Up);
         
         jon->m_jonShadow->onJump();
 
@@ -1361,41 +1441,19 @@ void Jon::Vampire::execute(Jon* jon)
         m_lastKnownVelocity->set(jon->m_velocity);
         m_fTimeSinceLastVelocityCheck = 0;
         
-        Jon* afterImage = new Jon(jon->getGridX(), jon->getGridY());
-        afterImage->m_formStateMachine = new StateMachine<Jon, JonFormState>(afterImage);
-        afterImage->m_formStateMachine->setCurrentState(jon->m_formStateMachine->getCurrentState());
-        afterImage->m_velocity.set(jon->m_velocity);
-        afterImage->m_position.set(jon->m_position);
-        afterImage->m_state = jon->m_state;
-        afterImage->m_physicalState = jon->m_physicalState;
-        afterImage->m_actionState = jon->m_actionState;
-        afterImage->m_abilityState = jon->m_abilityState;
-        afterImage->m_groundSoundType = jon->m_groundSoundType;
-        
-        afterImage->m_color = jon->m_color;
-        afterImage->m_fDeltaTime = jon->m_fDeltaTime;
-        afterImage->m_fActionStateTime = jon->m_fActionStateTime;
-        afterImage->m_fAbilityStateTime = jon->m_fAbilityStateTime;
-        afterImage->m_fTransformStateTime = jon->m_fTransformStateTime;
-        
-        afterImage->m_fDyingStateTime = jon->m_fDyingStateTime;
-        afterImage->m_fDefaultMaxSpeed = jon->m_fDefaultMaxSpeed;
-        afterImage->m_fMaxSpeed = jon->m_fMaxSpeed;
-        afterImage->m_fAccelerationX = jon->m_fAccelerationX;
+        if (jon->m_afterImages.size() == MAX_NUM_JON_AFTER_IMAGES)
+        {
+            jon->m_afterImages.erase(jon->m_afterImages.begin());
+        }
         
-        afterImage->m_iNumVampireJumps = jon->m_iNumVampireJumps;
-        afterImage->m_isLanding = jon->m_isLanding;
-        afterImage->m_isRightFoot = jon->m_isRightFoot;
-        afterImage->m_isAllowedToMove = jon->m_isAllowedToMove;
-        afterImage->m_fHeight = jon->m_fHeight;
-        afterImage->m_fWidth = jon->m_fWidth;
-        afterImage->m_fStateTime = jon->m_fStateTime;
+        JonAfterImage afterImage;
+        jon->captureAfterImage(afterImage);
         
-        afterImage->m_color.red *= 0.9f;
-        afterImage->m_color.green *= 0.9f;
-        afterImage->m_color.blue *= 1.1f;
-        afterImage->m_color.alpha *= (vDist + 0.25f);
-        afterImage->m_color.alpha = clamp(afterImage->m_color.alpha, 1, 0);
+        afterImage.color.red *= 0.9f;
+        afterImage.color.green *= 0.9f;
+        afterImage.color.blue *= 1.1f;
+        afterImage.color.alpha *= (vDist + 0.25f);
+        afterImage.color.alpha = clamp(afterImage.color.alpha, 1, 0);
         
         jon->m_afterImages.push_back(afterImage);
     }
@@ -1530,7 +1588,7 @@ void Jon::Vampire::triggerJump(Jon* jon)
 			jon->m_acceleration.setY(GAME_GRAVITY);
 			jon->m_velocity.setY(7 - jon->m_iNumVampireJumps);
             
-            jon->m_dustClouds.push_back(DustCloud::create(jon->getPosition().getX(), jon->getPosition().getY() - jon->getHeight() / 3, DustCloudType_Kick_Up));
+            jon->m_dustClouds->spawn()->init(jon->getPosition().getX(), jon->getPosition().getY() - jon->getHeight() / 3, DustCloudType_Kick_Up);
             
             jon->m_jonShadow->onJump();
 
@@ -2029,7 +2087,7 @@ JonShadowState JonShadow::getState()
     return m_state;
 }
 
-RTTI_IMPL(Jon, GridLockedPhysicalEntity);
+RTTI_IMPL_TAG(Jon, GridLockedPhysicalEntity, TYPE_TAG_JON);
 RTTI_IMPL(Jon::Rabbit, JonFormState);
 RTTI_IMPL(Jon::Vampire, JonFormState);
 RTTI_IMPL(Jon::RabbitToVampire, JonFormState);
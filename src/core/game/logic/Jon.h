@@ -24,10 +24,38 @@
 
 class Game;
 class DustCloud;
+template<typename T> class EffectPool;
 class ForegroundObject;
 
 class JonShadow;
 
+// A copy of what the vampire looked like at one moment, enough to pick the frame he was showing
+struct JonAfterImage
+{
+    float x;
+    float y;
+    float width;
+    float height;
+    Color color;
+    JonState state;
+    JonPhysicalState physicalState;
+    JonActionState actionState;
+    JonAbilityState abilityState;
+    float stateTime;
+    float actionStateTime;
+    float abilityStateTime;
+    float dyingStateTime;
+    float velocityX;
+    float velocityY;
+    bool isLanding;
+    bool isClimbingLedge;
+    
+    JonAfterImage() : color(1, 1, 1, 1)
+    {
+        // Empty
+    }
+};
+
 class Jon : public GridLockedPhysicalEntity
 {
     RTTI_DECL;
@@ -43,6 +71,8 @@ public:
     
     virtual void updateBounds();
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     void triggerTransform();
     
     void triggerCancelTransform();
@@ -71,7 +101,10 @@ public:
     
     JonShadow* getJonShadow();
     
-    std::vector<Jon *>& getAfterImages();
+    // Oldest first, drawn in one batch
+    std::vector<JonAfterImage>& getAfterImages();
+    
+    void captureAfterImage(JonAfterImage& afterImage);
     
     JonState getState();
     
@@ -186,9 +219,9 @@ public:
 private:
     StateMachine<Jon, JonFormState>* m_formStateMachine;
     Game* m_game;
-    std::vector<DustCloud *> m_dustClouds;
+    EffectPool<DustCloud>* m_dustClouds;
     JonShadow* m_jonShadow;
-    std::vector<Jon *> m_afterImages;
+    std::vector<JonAfterImage> m_afterImages;
     JonState m_state;
     JonPhysicalState m_physicalState;
     JonActionState m_actionState;
@@ -0,0 +1,282 @@
+//
+//  LevelJsonHandler.cpp
+//  nosfuratu
+//
+
+#include "pch.h"
+
+#include "LevelJsonHandler.h"
+
+#include "Game.h"
+
+#include <assert.h>
+#include <string.h>
+
+// In CompiledLevelSection order
+static const char* SECTION_KEYS[NUM_COMPILED_LEVEL_SECTIONS] =
+{
+    midgroundsKey,
+    groundsKey,
+    pitsKey,
+    exitGroundsKey,
+    holesKey,
+    foregroundObjectsKey,
+    midBossForegroundObjectsKey,
+    endBossForegroundObjectsKey,
+    countHissWithMinasKey,
+    endBossSnakesKey,
+    enemiesKey,
+    collectiblesKey,
+    jonsKey,
+    extraForegroundObjectsKey,
+    foregroundCoverObjectsKey,
+    markersKey
+};
+
+static bool isKey(const char* key, rapidjson::SizeType length, const char* name)
+{
+    return strlen(name) == length && memcmp(key, name, length) == 0;
+}
+
+LevelJsonHandler::LevelJsonHandler(Game* game) :
+m_game(game),
+m_objectDepths(0),
+m_field(Field_None),
+m_iDepth(0),
+m_iSection(-1),
+m_iPendingSection(-1),
+m_iWorld(0),
+m_iLevel(0),
+m_isExpectingKey(false),
+m_isInRecord(false),
+m_hasGridX(false),
+m_hasGridY(false),
+m_hasWorld(false),
+m_hasLevel(false)
+{
+    m_record.gridX = 0;
+    m_record.gridY = 0;
+    m_record.type = 0;
+}
+
+void LevelJsonHandler::Null()
+{
+    onValueEnded();
+}
+
+void LevelJsonHandler::Bool(bool b)
+{
+    onValueEnded();
+}
+
+void LevelJsonHandler::Int(int i)
+{
+    onValue(i);
+}
+
+void LevelJsonHandler::Uint(unsigned u)
+{
+    onValue((int) u);
+}
+
+void LevelJsonHandler::Int64(int64_t i)
+{
+    onValueEnded();
+}
+
+void LevelJsonHandler::Uint64(uint64_t u)
+{
+    onValueEnded();
+}
+
+void LevelJsonHandler::Double(double d)
+{
+    onValueEnded();
+}
+
+void LevelJsonHandler::String(const char* str, rapidjson::SizeType length, bool copy)
+{
+    if (isInObject()
+        && m_isExpectingKey)
+    {
+        onKey(str, length);
+    }
+    else
+    {
+        onValueEnded();
+    }
+}
+
+void LevelJsonHandler::StartObject()
+{
+    if (m_iSection >= 0
+        && m_iDepth == 2)
+    {
+        m_record.gridX = 0;
+        m_record.gridY = 0;
+        m_record.type = 0;
+        
+        m_isInRecord = true;
+        m_hasGridX = false;
+        m_hasGridY = false;
+    }
+    
+    assert(m_iDepth < MAX_LEVEL_JSON_DEPTH);
+    
+    m_objectDepths |= 1u << m_iDepth;
+    m_iDepth++;
+    
+    m_field = Field_None;
+    m_isExpectingKey = true;
+}
+
+void LevelJsonHandler::EndObject(rapidjson::SizeType memberCount)
+{
+    m_iDepth--;
+    
+    if (m_isInRecord
+        && m_iDepth == 2)
+    {
+        assert(m_hasGridX && m_hasGridY);
+        
+        m_game->loadRecord((CompiledLevelSection) m_iSection, m_record);
+        
+        m_isInRecord = false;
+    }
+    
+    onValueEnded();
+}
+
+void LevelJsonHandler::StartArray()
+{
+    if (m_field == Field_Section
+        && m_iDepth == 1)
+    {
+        m_iSection = m_iPendingSection;
+    }
+    
+    assert(m_iDepth < MAX_LEVEL_JSON_DEPTH);
+    
+    m_objectDepths &= ~(1u << m_iDepth);
+    m_iDepth++;
+    
+    m_field = Field_None;
+    m_isExpectingKey = false;
+}
+
+void LevelJsonHandler::EndArray(rapidjson::SizeType elementCount)
+{
+    m_iDepth--;
+    
+    if (m_iDepth == 1)
+    {
+        m_iSection = -1;
+    }
+    
+    onValueEnded();
+}
+
+bool LevelJsonHandler::hasWorldAndLevel()
+{
+    return m_hasWorld && m_hasLevel;
+}
+
+int LevelJsonHandler::getWorld()
+{
+    return m_iWorld;
+}
+
+int LevelJsonHandler::getLevel()
+{
+    return m_iLevel;
+}
+
+#pragma mark private
+
+void LevelJsonHandler::onValue(int value)
+{
+    switch (m_field)
+    {
+        case Field_World:
+            m_iWorld = value;
+            m_hasWorld = true;
+            break;
+        case Field_Level:
+            m_iLevel = value;
+            m_hasLevel = true;
+            break;
+        case Field_GridX:
+            m_record.gridX = value;
+            m_hasGridX = true;
+            break;
+        case Field_GridY:
+            m_record.gridY = value;
+            m_hasGridY = true;
+            break;
+        case Field_Type:
+            m_record.type = value;
+            break;
+        default:
+            break;
+    }
+    
+    onValueEnded();
+}
+
+void LevelJsonHandler::onKey(const char* key, rapidjson::SizeType length)
+{
+    m_field = Field_None;
+    m_isExpectingKey = false;
+    
+    if (m_iDepth == 1)
+    {
+        if (isKey(key, length, worldKey))
+        {
+            m_field = Field_World;
+        }
+        else if (isKey(key, length, levelKey))
+        {
+            m_field = Field_Level;
+        }
+        else
+        {
+            for (int i = 0; i < NUM_COMPILED_LEVEL_SECTIONS; ++i)
+            {
+                if (isKey(key, length, SECTION_KEYS[i]))
+                {
+                    m_field = Field_Section;
+                    m_iPendingSection = i;
+                    
+                    break;
+                }
+            }
+        }
+    }
+    else if (m_isInRecord
+             && m_iDepth == 3)
+    {
+        if (isKey(key, length, gridXKey))
+        {
+            m_field = Field_GridX;
+        }
+        else if (isKey(key, length, gridYKey))
+        {
+            m_field = Field_GridY;
+        }
+        else if (isKey(key, length, typeKey))
+        {
+            m_field = Field_Type;
+        }
+    }
+}
+
+void LevelJsonHandler::onValueEnded()
+{
+    m_field = Field_None;
+    m_isExpectingKey = isInObject();
+}
+
+bool LevelJsonHandler::isInObject()
+{
+    return m_iDepth > 0 && (m_objectDepths & (1u << (m_iDepth - 1))) != 0;
+}
@@ -0,0 +1,120 @@
+//
+//  LevelJsonHandler.h
+//  nosfuratu
+//
+
+#ifndef __nosfuratu__LevelJsonHandler__
+#define __nosfuratu__LevelJsonHandler__
+
+#include "CompiledLevel.h"
+
+#include "rapidjson/reader.h"
+
+#include <stdint.h>
+
+#define worldKey "world"
+#define levelKey "level"
+
+#define midgroundsKey "midgrounds"
+#define groundsKey "grounds"
+#define pitsKey "pits"
+#define exitGroundsKey "exitGrounds"
+#define holesKey "holes"
+#define foregroundObjectsKey "foregroundObjects"
+#define midBossForegroundObjectsKey "midBossForegroundObjects"
+#define endBossForegroundObjectsKey "endBossForegroundObjects"
+#define countHissWithMinasKey "countHissWithMinas"
+#define endBossSnakesKey "endBossSnakes"
+#define enemiesKey "enemies"
+#define collectiblesKey "collectibles"
+#define jonsKey "jons"
+#define extraForegroundObjectsKey "extraForegroundObjects"
+#define foregroundCoverObjectsKey "foregroundCoverObjects"
+#define markersKey "markers"
+
+#define gridXKey "gridX"
+#define gridYKey "gridY"
+#define typeKey "type"
+
+#define MAX_LEVEL_JSON_DEPTH 32
+
+class Game;
+
+// A rapidjson reader handler that turns a level's JSON straight into entities, without building a document first
+class LevelJsonHandler
+{
+public:
+    LevelJsonHandler(Game* game);
+    
+    void Null();
+    
+    void Bool(bool b);
+    
+    void Int(int i);
+    
+    void Uint(unsigned u);
+    
+    void Int64(int64_t i);
+    
+    void Uint64(uint64_t u);
+    
+    void Double(double d);
+    
+    void String(const char* str, rapidjson::SizeType length, bool copy);
+    
+    void StartObject();
+    
+    void EndObject(rapidjson::SizeType memberCount);
+    
+    void StartArray();
+    
+    void EndArray(rapidjson::SizeType elementCount);
+    
+    bool hasWorldAndLevel();
+    
+    int getWorld();
+    
+    int getLevel();
+
+private:
+    enum Field
+    {
+        Field_None,
+        Field_World,
+        Field_Level,
+        Field_Section,
+        Field_GridX,
+        Field_GridY,
+        Field_Type
+    };
+    
+    Game* m_game;
+    CompiledLevelRecord m_record;
+    uint32_t m_objectDepths;
+    Field m_field;
+    int m_iDepth;
+    int m_iSection;
+    int m_iPendingSection;
+    int m_iWorld;
+    int m_iLevel;
+    bool m_isExpectingKey;
+    bool m_isInRecord;
+    bool m_hasGridX;
+    bool m_hasGridY;
+    bool m_hasWorld;
+    bool m_hasLevel;
+    
+    void onValue(int value);
+    
+    void onKey(const char* key, rapidjson::SizeType length);
+    
+    void onValueEnded();
+    
+    bool isInObject();
+    
+    // Prevent copying
+    LevelJsonHandler(const LevelJsonHandler&);
+    LevelJsonHandler& operator=(const LevelJsonHandler&);
+};
+
+#endif /* defined(__nosfuratu__LevelJsonHandler__) */
@@ -0,0 +1,98 @@
+//
+//  LevelRegistry.cpp
+//  nosfuratu
+//
+
+#include "pch.h"
+
+#include "LevelRegistry.h"
+
+#include "Game.h"
+
+#include <assert.h>
+#include <chrono>
+
+LevelRegistry* LevelRegistry::getInstance()
+{
+    static LevelRegistry instance = LevelRegistry();
+    return &instance;
+}
+
+const LevelSource* LevelRegistry::getSource(int world, int level)
+{
+    int index = indexOf(world, level);
+    
+    return index >= 0 ? &LEVEL_SOURCES[index] : nullptr;
+}
+
+const char* LevelRegistry::getJson(int world, int level)
+{
+    const LevelSource* source = getSource(world, level);
+    assert(source);
+    
+    return source->json;
+}
+
+size_t LevelRegistry::getSize(int world, int level)
+{
+    const LevelSource* source = getSource(world, level);
+    
+    return source ? source->length : 0;
+}
+
+size_t LevelRegistry::getTotalSize()
+{
+    size_t ret = 0;
+    
+    for (int i = 0; i < NUM_LEVEL_SOURCES; ++i)
+    {
+        ret += LEVEL_SOURCES[i].length;
+    }
+    
+    return ret;
+}
+
+int LevelRegistry::getNumLevels()
+{
+    return NUM_LEVEL_SOURCES;
+}
+
+void LevelRegistry::load(Game* game, int world, int level)
+{
+    int index = indexOf(world, level);
+    assert(index >= 0);
+    
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    
+    game->load(LEVEL_SOURCES[index].json);
+    
+    m_lastLoadTimes[index] = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+float LevelRegistry::getLastLoadTime(int world, int level)
+{
+    int index = indexOf(world, level);
+    
+    return index >= 0 ? m_lastLoadTimes[index] : -1;
+}
+
+#pragma mark private
+
+int LevelRegistry::indexOf(int world, int level)
+{
+    for (int i = 0; i < NUM_LEVEL_SOURCES; ++i)
+    {
+        if (LEVEL_SOURCES[i].world == world
+            && LEVEL_SOURCES[i].level == level)
+        {
+            return i;
+        }
+    }
+    
+    return -1;
+}
+
+LevelRegistry::LevelRegistry() : m_lastLoadTimes(NUM_LEVEL_SOURCES, -1)
+{
+    // Empty
+}
@@ -0,0 +1,59 @@
+//
+//  LevelRegistry.h
+//  nosfuratu
+//
+
+#ifndef __nosfuratu__LevelRegistry__
+#define __nosfuratu__LevelRegistry__
+
+#include <stddef.h>
+#include <vector>
+
+class Game;
+
+struct LevelSource
+{
+    int world;
+    int level;
+    const char* json;
+    size_t length;
+};
+
+// Defined in LevelSources.cpp
+extern const LevelSource LEVEL_SOURCES[];
+extern const int NUM_LEVEL_SOURCES;
+
+// The JSON of every shipped level, kept as constant data and only touched once that level is loaded
+class LevelRegistry
+{
+public:
+    static LevelRegistry* getInstance();
+    
+    // nullptr for a level that doesn't exist
+    const LevelSource* getSource(int world, int level);
+    
+    const char* getJson(int world, int level);
+    
+    size_t getSize(int world, int level);
+    
+    size_t getTotalSize();
+    
+    int getNumLevels();
+    
+    void load(Game* game, int world, int level);
+    
+    // In milliseconds, -1 until the level has been loaded
+    float getLastLoadTime(int world, int level);
+
+private:
+    std::vector<float> m_lastLoadTimes;
+    
+    int indexOf(int world, int level);
+    
+    // ctor, copy ctor, and assignment should be private in a Singleton
+    LevelRegistry();
+    LevelRegistry(const LevelRegistry&);
+    LevelRegistry& operator=(const LevelRegistry&);
+};
+
+#endif /* defined(__nosfuratu__LevelRegistry__) */
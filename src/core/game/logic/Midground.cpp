@@ -73,6 +73,13 @@ Midground::Midground(int gridX, int gridY, int gridWidth, int gridHeight, Midgro
     updateBounds();
 }
 
+void Midground::resetToSnapshot(int gridX, int gridY)
+{
+    GridLockedPhysicalEntity::resetToSnapshot(gridX, gridY);
+    
+    updateBounds();
+}
+
 MidgroundType Midground::getType()
 {
     return m_type;
@@ -24,6 +24,8 @@ public:
     
     Midground(int gridX, int gridY, int gridWidth, int gridHeight, MidgroundType type);
     
+    virtual void resetToSnapshot(int gridX, int gridY);
+    
     MidgroundType getType();
     
 private:
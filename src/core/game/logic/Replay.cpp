@@ -0,0 +1,318 @@
+//
+//  Replay.cpp
+//  nosfuratu
+//
+
+#include "pch.h"
+
+#include "Replay.h"
+
+#ifdef __APPLE__
+#include "TargetConditionals.h"
+#endif
+
+#if TARGET_OS_IPHONE
+#include "apple_asset_data_handler.h"
+#endif
+
+#if defined __ANDROID__
+#include "AndroidAssetDataHandler.h"
+#endif
+
+#include <assert.h>
+#include <stdio.h>
+#include <string>
+#include <sstream>
+
+static void writeInt(std::vector<unsigned char>& data, int value)
+{
+    unsigned int v = (unsigned int) value;
+    
+    data.push_back((unsigned char) (v & 0xFF));
+    data.push_back((unsigned char) ((v >> 8) & 0xFF));
+    data.push_back((unsigned char) ((v >> 16) & 0xFF));
+    data.push_back((unsigned char) ((v >> 24) & 0xFF));
+}
+
+static int readInt(const unsigned char* data)
+{
+    unsigned int v = data[0] | (data[1] << 8) | (data[2] << 16) | ((unsigned int) data[3] << 24);
+    
+    return (int) v;
+}
+
+static void writeVarInt(std::vector<unsigned char>& data, unsigned int value)
+{
+    while (value >= 0x80)
+    {
+        data.push_back((unsigned char) ((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    
+    data.push_back((unsigned char) value);
+}
+
+static bool readVarInt(const unsigned char* data, size_t length, size_t& offset, unsigned int& value)
+{
+    value = 0;
+    
+    for (int shift = 0; shift < 32; shift += 7)
+    {
+        if (offset >= length)
+        {
+            return false;
+        }
+        
+        unsigned char byte = data[offset++];
+        value |= (unsigned int) (byte & 0x7F) << shift;
+        
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+static std::string calcFinalPath(const char* filePath)
+{
+#if defined __ANDROID__
+    return std::string(ANDROID_ASSETS->getPathInsideApk(filePath));
+#elif TARGET_OS_IPHONE
+    return std::string(getPathInsideNSDocuments(filePath));
+#elif defined _WIN32
+	#if !defined(WINAPI_FAMILY) || WINAPI_FAMILY == WINAPI_FAMILY_DESKTOP_APP
+		return std::string(filePath);
+	#else
+		Windows::Storage::StorageFolder^ localFolder = Windows::Storage::ApplicationData::Current->LocalFolder;
+		Platform::String^ ps_path = localFolder->Path;
+		std::string s_path(ps_path->Begin(), ps_path->End());
+		std::stringstream ss;
+		ss << s_path << "\\" << filePath;
+		
+		return ss.str();
+	#endif
+#else
+    return std::string(filePath);
+#endif
+}
+
+Replay::Replay() :
+m_iWorld(0),
+m_iLevel(0),
+m_iJonAbilityFlag(0),
+m_iBestLevelStatsFlag(0),
+m_iNumTicks(0),
+m_isFinished(false)
+{
+    // Empty
+}
+
+void Replay::reset(int world, int level, int jonAbilityFlag, int bestLevelStatsFlag)
+{
+    m_userDemoActions.clear();
+    
+    m_iWorld = world;
+    m_iLevel = level;
+    m_iJonAbilityFlag = jonAbilityFlag;
+    m_iBestLevelStatsFlag = bestLevelStatsFlag;
+    m_iNumTicks = 0;
+    m_isFinished = false;
+}
+
+void Replay::record(DemoAction action, int tick)
+{
+    if (m_isFinished)
+    {
+        return;
+    }
+    
+    assert(m_userDemoActions.size() == 0 || m_userDemoActions.back().m_iTickToExecuteAction <= tick);
+    
+    m_userDemoActions.push_back(UserDemoAction(action, 0, tick));
+    
+    if (tick > m_iNumTicks)
+    {
+        m_iNumTicks = tick;
+    }
+}
+
+void Replay::finish(int numTicks)
+{
+    if (m_isFinished)
+    {
+        return;
+    }
+    
+    record(DemoAction_Exit, numTicks);
+    
+    m_isFinished = true;
+}
+
+void Replay::serialize(std::vector<unsigned char>& data)
+{
+    data.clear();
+    data.reserve(REPLAY_HEADER_SIZE + m_userDemoActions.size() * 2);
+    
+    writeInt(data, REPLAY_MAGIC);
+    writeInt(data, REPLAY_VERSION);
+    writeInt(data, m_iWorld);
+    writeInt(data, m_iLevel);
+    writeInt(data, m_iJonAbilityFlag);
+    writeInt(data, m_iBestLevelStatsFlag);
+    writeInt(data, m_iNumTicks);
+    writeInt(data, (int) m_userDemoActions.size());
+    
+    int lastTick = 0;
+    for (std::vector<UserDemoAction>::iterator i = m_userDemoActions.begin(); i != m_userDemoActions.end(); ++i)
+    {
+        writeVarInt(data, (unsigned int) ((*i).m_iTickToExecuteAction - lastTick));
+        data.push_back((unsigned char) (*i).m_action);
+        
+        lastTick = (*i).m_iTickToExecuteAction;
+    }
+}
+
+bool Replay::deserialize(const unsigned char* data, size_t length)
+{
+    if (length < REPLAY_HEADER_SIZE
+        || readInt(data) != REPLAY_MAGIC
+        || readInt(data + 4) != REPLAY_VERSION)
+    {
+        return false;
+    }
+    
+    reset(readInt(data + 8), readInt(data + 12), readInt(data + 16), readInt(data + 20));
+    
+    int numTicks = readInt(data + 24);
+    int numActions = readInt(data + 28);
+    
+    // Every action takes at least 2 bytes
+    if (numTicks < 0
+        || numActions < 0
+        || (size_t) numActions > (length - REPLAY_HEADER_SIZE) / 2)
+    {
+        return false;
+    }
+    
+    m_userDemoActions.reserve(numActions);
+    
+    size_t offset = REPLAY_HEADER_SIZE;
+    int tick = 0;
+    for (int i = 0; i < numActions; ++i)
+    {
+        unsigned int tickDelta;
+        if (!readVarInt(data, length, offset, tickDelta)
+            || offset >= length
+            || data[offset] >= NUM_DEMO_ACTIONS)
+        {
+            reset(0, 0, 0, 0);
+            
+            return false;
+        }
+        
+        tick += (int) tickDelta;
+        
+        m_userDemoActions.push_back(UserDemoAction((DemoAction) data[offset++], 0, tick));
+    }
+    
+    m_iNumTicks = numTicks;
+    m_isFinished = true;
+    
+    return true;
+}
+
+bool Replay::save(const char* filePath)
+{
+    assert(filePath);
+    
+    std::string finalPath = calcFinalPath(filePath);
+    
+    FILE *file;
+#ifdef _WIN32
+    errno_t err;
+    if ((err = fopen_s(&file, finalPath.c_str(), "wb")) != 0)
+    {
+#else
+    if ((file = fopen(finalPath.c_str(), "wb")) == NULL)
+    {
+#endif
+        return false;
+    }
+    
+    std::vector<unsigned char> data;
+    serialize(data);
+    
+    size_t numBytesWritten = fwrite(&data[0], 1, data.size(), file);
+    
+    fclose(file);
+    
+    return numBytesWritten == data.size();
+}
+
+bool Replay::load(const char* filePath)
+{
+    assert(filePath);
+    
+    std::string finalPath = calcFinalPath(filePath);
+    
+    FILE *file;
+#ifdef _WIN32
+    errno_t err;
+    if ((err = fopen_s(&file, finalPath.c_str(), "rb")) != 0)
+    {
+#else
+    if ((file = fopen(finalPath.c_str(), "rb")) == NULL)
+    {
+#endif
+        return false;
+    }
+    
+    std::vector<unsigned char> data;
+    unsigned char buffer[4096];
+    size_t numBytesRead;
+    while ((numBytesRead = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        data.insert(data.end(), buffer, buffer + numBytesRead);
+    }
+    
+    fclose(file);
+    
+    return data.size() > 0 && deserialize(&data[0], data.size());
+}
+
+std::vector<UserDemoAction>& Replay::getUserDemoActions()
+{
+    return m_userDemoActions;
+}
+
+int Replay::getWorld()
+{
+    return m_iWorld;
+}
+
+int Replay::getLevel()
+{
+    return m_iLevel;
+}
+
+int Replay::getJonAbilityFlag()
+{
+    return m_iJonAbilityFlag;
+}
+
+int Replay::getBestLevelStatsFlag()
+{
+    return m_iBestLevelStatsFlag;
+}
+
+int Replay::getNumTicks()
+{
+    return m_iNumTicks;
+}
+
+bool Replay::isFinished()
+{
+    return m_isFinished;
+}
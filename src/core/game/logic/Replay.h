@@ -0,0 +1,64 @@
+//
+//  Replay.h
+//  nosfuratu
+//
+
+#ifndef __nosfuratu__Replay__
+#define __nosfuratu__Replay__
+
+#include "UserDemoAction.h"
+
+#include <vector>
+#include <stddef.h>
+
+// All fields are little endian, each action is a varint tick delta followed by a DemoAction byte
+#define REPLAY_MAGIC 0x5052474E // NGRP
+#define REPLAY_VERSION 1
+#define REPLAY_HEADER_SIZE 32
+
+#define REPLAY_FILE_PATH "nosfuratu.ngreplay"
+
+class Replay
+{
+public:
+    Replay();
+    
+    void reset(int world, int level, int jonAbilityFlag, int bestLevelStatsFlag);
+    
+    void record(DemoAction action, int tick);
+    
+    void finish(int numTicks);
+    
+    void serialize(std::vector<unsigned char>& data);
+    
+    bool deserialize(const unsigned char* data, size_t length);
+    
+    bool save(const char* filePath);
+    
+    bool load(const char* filePath);
+    
+    std::vector<UserDemoAction>& getUserDemoActions();
+    
+    int getWorld();
+    
+    int getLevel();
+    
+    int getJonAbilityFlag();
+    
+    int getBestLevelStatsFlag();
+    
+    int getNumTicks();
+    
+    bool isFinished();
+
+private:
+    std::vector<UserDemoAction> m_userDemoActions;
+    int m_iWorld;
+    int m_iLevel;
+    int m_iJonAbilityFlag;
+    int m_iBestLevelStatsFlag;
+    int m_iNumTicks;
+    bool m_isFinished;
+};
+
+#endif /* defined(__nosfuratu__Replay__) */
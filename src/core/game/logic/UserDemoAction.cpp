@@ -0,0 +1,13 @@
+//
+//  UserDemoAction.cpp
+//  nosfuratu
+//
+
+#include "pch.h"
+
+#include "UserDemoAction.h"
+
+UserDemoAction::UserDemoAction(DemoAction action, float stateTimeToExecuteAction, int tickToExecuteAction) : m_action(action), m_fStateTimeToExecuteAction(stateTimeToExecuteAction), m_iTickToExecuteAction(tickToExecuteAction)
+{
+    // Empty
+}
@@ -0,0 +1,21 @@
+//
+//  UserDemoAction.h
+//  nosfuratu
+//
+
+#ifndef __nosfuratu__UserDemoAction__
+#define __nosfuratu__UserDemoAction__
+
+#include "DemoAction.h"
+
+class UserDemoAction
+{
+public:
+    DemoAction m_action;
+    float m_fStateTimeToExecuteAction;
+    int m_iTickToExecuteAction; // -1 for scripted demos, which go by state time instead
+    
+    UserDemoAction(DemoAction action, float stateTimeToExecuteAction, int tickToExecuteAction = -1);
+};
+
+#endif /* defined(__nosfuratu__UserDemoAction__) */
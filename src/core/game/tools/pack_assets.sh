@@ -0,0 +1,13 @@
+# Run after encrypt_textures_and_shaders.sh, packs every .ngt and .ngs into assets/assets.ngpak
+
+cd ../../framework/tools
+
+[ -x NGPackAssets ] || cc -std=c99 -O2 NGPackAssets.c -o NGPackAssets
+
+./NGPackAssets ../../../../assets/assets.ngpak \
+    ../graphics/opengl/shader/*.ngs \
+    ../../game/graphics/opengl/shader/*.ngs \
+    ../../../../assets/textures/*.ngt \
+    ../../../../assets/textures/compressed/*.ngt \
+    ../../../../assets/textures/desktop/*.ngt \
+    ../../../../assets/textures/level_editor/*.ngt
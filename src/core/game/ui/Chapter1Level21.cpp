@@ -203,7 +203,7 @@ void Chapter1Level21::enter(MainScreen* ms)
 		{
 			if ((*i)->getPosition().getX() < jon.getPosition().getX())
 			{
-                delete *i;
+                m_game->release(*i);
 				i = m_game->getCollectibleItems().erase(i);
 			}
 			else
@@ -558,7 +558,7 @@ void Chapter1Level21::configBatPanel()
     // Prevent
 }
 
-Chapter1Level21::Chapter1Level21(const char* json) : Level(json),
+Chapter1Level21::Chapter1Level21() : Level(1, 21),
 m_endBossSnake(nullptr),
 m_hole(nullptr),
 m_fGameStateTime(0),
@@ -584,8 +584,6 @@ m_hasTriggeredSnakeDeathCheckPoint(false)
 
 RTTI_IMPL(Chapter1Level21, Level);
 
-#include <sstream>
-
 /// Chapter 1 Level 21 ///
 
 Chapter1Level21 * Chapter1Level21::s_pInstance = nullptr;
@@ -594,13 +592,7 @@ void Chapter1Level21::create()
 {
     assert(!s_pInstance);
     
-    std::stringstream ss;
-    
-    ss << "{\"world\":1,\"level\":21,\"midgrounds\":[{\"gridX\":1460,\"gridY\":0,\"type\":5},{\"gridX\":1508,\"gridY\":0,\"type\":4},{\"gridX\":1548,\"gridY\":0,\"type\":5},{\"gridX\":1644,\"gridY\":0,\"type\":5},{\"gridX\":1600,\"gridY\":0,\"type\":4},{\"gridX\":1696,\"gridY\":0,\"type\":4},{\"gridX\":1744,\"gridY\":0,\"type\":5},{\"gridX\":1790,\"gridY\":0,\"type\":4},{\"gridX\":28,\"gridY\":96,\"type\":2},{\"gridX\":1292,\"gridY\":96,\"type\":2},{\"gridX\":1440,\"gridY\":96,\"type\":2},{\"gridX\":1588,\"gridY\":96,\"type\":2},{\"gridX\":1736,\"gridY\":96,\"type\":2},{\"gridX\":1888,\"gridY\":96,\"type\":2},{\"gridX\":2324,\"gridY\":96,\"type\":2},{\"gridX\":2504,\"gridY\":96,\"type\":2},{\"gridX\":2664,\"gridY\":96,\"type\":2},{\"gridX\":2824,\"gridY\":96,\"type\":2},{\"gridX\":2984,\"gridY\":96,\"type\":2},{\"gridX\":3144,\"gridY\":96,\"type\":2},{\"gridX\":3308,\"gridY\":96,\"type\":2},{\"gridX\":144,\"gridY\":0,\"type\":5},{\"gridX\":188,\"gridY\":0,\"type\":4},{\"gridX\":216,\"gridY\":0,\"type\":4},{\"gridX\":1068,\"gridY\":0,\"type\":5},{\"gridX\":1120,\"gridY\":0,\"type\":4},{\"gridX\":1272,\"gridY\":0,\"type\":5},{\"gridX\":2244,\"gridY\":0,\"type\":5},{\"gridX\":2280,\"gridY\":0,\"type\":4},{\"gridX\":2364,\"gridY\":0,\"type\":4},{\"gridX\":2448,\"gridY\":0,\"type\":4},{\"gridX\":2504,\"gridY\":0,\"type\":4},{\"gridX\":2532,\"gridY\":0,\"type\":4},{\"gridX\":2548,\"gridY\":0,\"type\":5},{\"gridX\":3808,\"gridY\":96,\"type\":2},{\"gridX\":3972,\"gridY\":96,\"type\":2},{\"gridX\":4132,\"gridY\":96,\"type\":2},{\"gridX\":4292,\"gridY\":96,\"type\":2},{\"gridX\":4452,\"gridY\":96,\"type\":2},{\"gridX\":4516,\"gridY\":96,\"type\":2},{\"gridX\":4692,\"gridY\":96,\"type\":2},{\"gridX\":4804,\"gridY\":96,\"type\":2},{\"gridX\":4916,\"gridY\":96,\"type\":2},{\"gridX\":5028,\"gridY\":96,\"type\":2},{\"gridX\":5172,\"gridY\":96,\"type\":2},{\"gridX\":5896,\"gridY\":96,\"type\":2},{\"gridX\":5272,\"gridY\":96,\"type\":2},{\"gridX\":2732,\"gridY\":0,\"type\":4},{\"gridX\":2800,\"gridY\":0,\"type\":4},{\"gridX\":2756,\"gridY\":0,\"type\":5},{\"gridX\":2832,\"gridY\":0,\"type\":4},{\"gridX\":2892,\"gridY\":0,\"type\":4},{\"gridX\":2908,\"gridY\":0,\"type\":5},{\"gridX\":2932,\"gridY\":0,\"type\":5},{\"gridX\":2978,\"gridY\":0,\"type\":4},{\"gridX\":3060,\"gridY\":0,\"type\":5},{\"gridX\":3504,\"gridY\":0,\"type\":5},{\"gridX\":3532,\"gridY\":0,\"type\":5},{\"gridX\":3612,\"gridY\":0,\"type\":5},{\"gridX\":3644,\"gridY\":0,\"type\":4},{\"gridX\":3688,\"gridY\":0,\"type\":5},{\"gridX\":3732,\"gridY\":0,\"type\":5},{\"gridX\":3772,\"gridY\":0,\"type\":4},{\"gridX\":3836,\"gridY\":0,\"type\":4},{\"gridX\":3908,\"gridY\":0,\"type\":5},{\"gridX\":4180,\"gridY\":0,\"type\":5},{\"gridX\":4164,\"gridY\":0,\"type\":4},{\"gridX\":4280,\"gridY\":0,\"type\":5},{\"gridX\":4300,\"gridY\":0,\"type\":4},{\"gridX\":4384,\"gridY\":0,\"type\":4},{\"gridX\":4428,\"gridY\":0,\"type\":4},{\"gridX\":4480,\"gridY\":0,\"type\":5},{\"gridX\":4588,\"gridY\":0,\"type\":5},{\"gridX\":4612,\"gridY\":0,\"type\":4},{\"gridX\":4632,\"gridY\":0,\"type\":4},{\"gridX\":4644,\"gridY\":0,\"type\":5},{\"gridX\":4708,\"gridY\":0,\"type\":5},{\"gridX\":4744,\"gridY\":0,\"type\":5},{\"gridX\":4692,\"gridY\":0,\"type\":4},{\"gridX\":4836,\"gridY\":0,\"type\":5},{\"gridX\":4860,\"gridY\":0,\"type\":4},{\"gridX\":4896,\"gridY\":0,\"type\":5},{\"gridX\":4964,\"gridY\":0,\"type\":4},{\"gridX\":5004,\"gridY\":0,\"type\":5},{\"gridX\":5036,\"gridY\":0,\"type\":4},{\"gridX\":4988,\"gridY\":0,\"type\":4},{\"gridX\":2092,\"gridY\":96,\"type\":2},{\"gridX\":3416,\"gridY\":96,\"type\":2},{\"gridX\":5516,\"gridY\":96,\"type\":2},{\"gridX\":5704,\"gridY\":96,\"type\":2},{\"gridX\":5068,\"gridY\":0,\"type\":5},{\"gridX\":5148,\"gridY\":0,\"type\":5},{\"gridX\":5196,\"gridY\":0,\"type\":4},{\"gridX\":5244,\"gridY\":0,\"type\":4},{\"gridX\":5274,\"gridY\":0,\"type\":5},{\"gridX\":5304,\"gridY\":0,\"type\":5},{\"gridX\":5332,\"gridY\":0,\"type\":4},{\"gridX\":5400,\"gridY\":0,\"type\":5},{\"gridX\":5432,\"gridY\":0,\"type\":4},{\"gridX\":5464,\"gridY\":0,\"type\":4},{\"gridX\":5488,\"gridY\":0,\"type\":5},{\"gridX\":5514,\"gridY\":0,\"type\":4},{\"gridX\":5528,\"gridY\":0,\"type\":5},{\"gridX\":5604,\"gridY\":0,\"type\":5},{\"gridX\":5580,\"gridY\":0,\"type\":4},{\"gridX\":5636,\"gridY\":0,\"type\":4},{\"gridX\":5712,\"gridY\":0,\"type\":4},{\"gridX\":5728,\"gridY\":0,\"type\":5},{\"gridX\":5812,\"gridY\":0,\"type\":4},{\"gridX\":5824,\"gridY\":0,\"type\":4},{\"gridX\":1868,\"gridY\":0,\"type\":4},{\"gridX\":1888,\"gridY\":0,\"type\":5},{\"gridX\":1947,\"gridY\":0,\"type\":4},{\"gridX\":1924,\"gridY\":0,\"type\":5},{\"gridX\":1976,\"gridY\":0,\"type\":4},{\"gridX\":1988,\"gridY\":0,\"type\":5},{\"gridX\":2008,\"gridY\":0,\"type\":5},{\"gridX\":2092,\"gridY\":0,\"type\":5},{\"gridX\":2112,\"gridY\":0,\"type\":4},{\"gridX\":4108,\"gridY\":0,\"type\":5},{\"gridX\":1164,\"gridY\":0,\"type\":4},{\"gridX\":1232,\"gridY\":0,\"type\":5},{\"gridX\":1064,\"gridY\":96,\"type\":2},{\"gridX\":2328,\"gridY\":0,\"type\":5},{\"gridX\":2412,\"gridY\":0,\"type\":4},{\"gridX\":3812,\"gridY\":0,\"type\":4},{\"gridX\":248,\"gridY\":96,\"type\":2},{\"gridX\":444,\"gridY\":96,\"type\":2},{\"gridX\":644,\"gridY\":96,\"type\":2},{\"gridX\":792,\"gridY\":96,\"type\":2},{\"gridX\":256,\"gridY\":0,\"type\":5},{\"gridX\":324,\"gridY\":0,\"type\":4},{\"gridX\":360,\"gridY\":0,\"type\":5},{\"gridX\":396,\"gridY\":0,\"type\":5},{\"gridX\":440,\"gridY\":0,\"type\":4},{\"gridX\":516,\"gridY\":0,\"type\":4},{\"gridX\":496,\"gridY\":0,\"type\":5},{\"gridX\":984,\"gridY\":0,\"type\":4},{\"gridX\":1008,\"gridY\":0,\"type\":5},{\"gridX\":3652,\"gridY\":96,\"type\":14},{\"gridX\":2288,\"gridY\":96,\"type\":14},{\"gridX\":1028,\"gridY\":96,\"type\":14},{\"gridX\":1088,\"gridY\":0,\"type\":21},{\"gridX\":1216,\"gridY\":0,\"type\":22},{\"gridX\":1260,\"gridY\":0,\"type\":21},{\"gridX\":1096,\"gridY\":0,\"type\":22},{\"gridX\":1136,\"gridY\":0,\"type\":22},{\"gridX\":1148,\"gridY\":0,\"type\":21},{\"gridX\":2348,\"gridY\":0,\"type\":21},{\"gridX\":2380,\"gridY\":0,\"type\":22},{\"gridX\":2388,\"gridY\":0,\"type\":22},{\"gridX\":2520,\"gridY\":0,\"type\":21},{\"gridX\":2516,\"gridY\":0,\"type\":22},{\"gridX\":2464,\"gridY\":0,\"type\":21},{\"gridX\":3656,\"gridY\":0,\"type\":22},{\"gridX\":3708,\"gridY\":0,\"type\":21},{\"gridX\":3712,\"gridY\":0,\"type\":21},{\"gridX\":3784,\"gridY\":0,\"type\":22},{\"gridX\":3792,\"gridY\":0,\"type\":21},{\"gridX\":3804,\"gridY\":0,\"type\":22},{\"gridX\":3852,\"gridY\":0,\"type\":21},{\"gridX\":3756,\"gridY\":0,\"type\":22},{\"gridX\":3872,\"gridY\":0,\"type\":21},{\"gridX\":3892,\"gridY\":0,\"type\":21},{\"gridX\":3864,\"gridY\":0,\"type\":22},{\"gridX\":3928,\"gridY\":0,\"type\":22},{\"gridX\":192,\"gridY\":96,\"type\":17},{\"gridX\":188,\"gridY\":113,\"type\":18},{\"gridX\":211,\"gridY\":96,\"type\":17},{\"gridX\":198,\"gridY\":120,\"type\":18},{\"gridX\":201,\"gridY\":106,\"type\":17},{\"gridX\":209,\"gridY\":125,\"type\":17},{\"gridX\":221,\"gridY\":108,\"type\":17},{\"gridX\":212,\"gridY\":136,\"type\":18},{\"gridX\":204,\"gridY\":147,\"type\":18},{\"gridX\":203,\"gridY\":155,\"type\":17}],\"grounds\":[{\"gridX\":0,\"gridY\":0,\"type\":0},{\"gridX\":5832,\"gridY\":0,\"type\":1},{\"gridX\":5640,\"gridY\":0,\"type\":2},{\"gridX\":2440,\"gridY\":0,\"type\":2},{\"gridX\":3784,\"gridY\":0,\"type\":2},{\"gridX\":1416,\"gridY\":0,\"type\":3},{\"gridX\":1544,\"gridY\":0,\"type\":3},{\"gridX\":1672,\"gridY\":0,\"type\":3},{\"gridX\":1800,\"gridY\":0,\"type\":3},{\"gridX\":1928,\"gridY\":0,\"type\":3},{\"gridX\":2184,\"gridY\":0,\"type\":3},{\"gridX\":2312,\"gridY\":0,\"type\":3},{\"gridX\":2504,\"gridY\":0,\"type\":3},{\"gridX\":2632,\"gridY\":0,\"type\":3},{\"gridX\":1288,\"gridY\":0,\"type\":3},{\"gridX\":2760,\"gridY\":0,\"type\":3},{\"gridX\":2888,\"gridY\":0,\"type\":3},{\"gridX\":3144,\"gridY\":0,\"type\":3},{\"gridX\":3528,\"gridY\":0,\"type\":3},{\"gridX\":3656,\"gridY\":0,\"type\":3},{\"gridX\":3976,\"gridY\":0,\"type\":3},{" << "\"gridX\":4104,\"gridY\":0,\"type\":3},{\"gridX\":4232,\"gridY\":0,\"type\":3},{\"gridX\":4360,\"gridY\":0,\"type\":3},{\"gridX\":4488,\"gridY\":0,\"type\":3},{\"gridX\":4616,\"gridY\":0,\"type\":3},{\"gridX\":4744,\"gridY\":0,\"type\":3},{\"gridX\":4872,\"gridY\":0,\"type\":3},{\"gridX\":5000,\"gridY\":0,\"type\":3},{\"gridX\":5128,\"gridY\":0,\"type\":3},{\"gridX\":8,\"gridY\":0,\"type\":3},{\"gridX\":136,\"gridY\":0,\"type\":3},{\"gridX\":264,\"gridY\":0,\"type\":3},{\"gridX\":3272,\"gridY\":0,\"type\":3},{\"gridX\":5256,\"gridY\":0,\"type\":3},{\"gridX\":3016,\"gridY\":0,\"type\":3},{\"gridX\":2056,\"gridY\":0,\"type\":3},{\"gridX\":3400,\"gridY\":0,\"type\":3},{\"gridX\":3848,\"gridY\":0,\"type\":3},{\"gridX\":1160,\"gridY\":0,\"type\":3},{\"gridX\":5384,\"gridY\":0,\"type\":3},{\"gridX\":5512,\"gridY\":0,\"type\":3},{\"gridX\":5704,\"gridY\":0,\"type\":3},{\"gridX\":392,\"gridY\":0,\"type\":3},{\"gridX\":520,\"gridY\":0,\"type\":3},{\"gridX\":648,\"gridY\":0,\"type\":3},{\"gridX\":776,\"gridY\":0,\"type\":3},{\"gridX\":904,\"gridY\":0,\"type\":3},{\"gridX\":1032,\"gridY\":0,\"type\":3},{\"gridX\":4568,\"gridY\":50,\"type\":10},{\"gridX\":5704,\"gridY\":50,\"type\":10},{\"gridX\":4824,\"gridY\":50,\"type\":10},{\"gridX\":2240,\"gridY\":50,\"type\":10},{\"gridX\":5800,\"gridY\":50,\"type\":10},{\"gridX\":1860,\"gridY\":50,\"type\":10},{\"gridX\":3488,\"gridY\":50,\"type\":10},{\"gridX\":2084,\"gridY\":50,\"type\":10},{\"gridX\":3608,\"gridY\":50,\"type\":10},{\"gridX\":1428,\"gridY\":50,\"type\":10},{\"gridX\":5136,\"gridY\":50,\"type\":10},{\"gridX\":140,\"gridY\":50,\"type\":10},{\"gridX\":2696,\"gridY\":50,\"type\":10},{\"gridX\":4064,\"gridY\":50,\"type\":10},{\"gridX\":5392,\"gridY\":50,\"type\":10},{\"gridX\":4256,\"gridY\":50,\"type\":10},{\"gridX\":632,\"gridY\":50,\"type\":10},{\"gridX\":972,\"gridY\":50,\"type\":10},{\"gridX\":852,\"gridY\":50,\"type\":10},{\"gridX\":2092,\"gridY\":50,\"type\":11},{\"gridX\":5712,\"gridY\":50,\"type\":11},{\"gridX\":5808,\"gridY\":50,\"type\":11},{\"gridX\":1996,\"gridY\":50,\"type\":11},{\"gridX\":4072,\"gridY\":50,\"type\":12},{\"gridX\":4136,\"gridY\":50,\"type\":12},{\"gridX\":4576,\"gridY\":50,\"type\":12},{\"gridX\":4640,\"gridY\":50,\"type\":12},{\"gridX\":4704,\"gridY\":50,\"type\":12},{\"gridX\":5272,\"gridY\":50,\"type\":12},{\"gridX\":5144,\"gridY\":50,\"type\":12},{\"gridX\":2376,\"gridY\":50,\"type\":12},{\"gridX\":3496,\"gridY\":50,\"type\":12},{\"gridX\":5208,\"gridY\":50,\"type\":12},{\"gridX\":980,\"gridY\":50,\"type\":12},{\"gridX\":860,\"gridY\":50,\"type\":12},{\"gridX\":3744,\"gridY\":50,\"type\":12},{\"gridX\":1436,\"gridY\":50,\"type\":13},{\"gridX\":1692,\"gridY\":50,\"type\":13},{\"gridX\":148,\"gridY\":50,\"type\":13},{\"gridX\":3808,\"gridY\":50,\"type\":13},{\"gridX\":4960,\"gridY\":50,\"type\":13},{\"gridX\":2248,\"gridY\":50,\"type\":13},{\"gridX\":4832,\"gridY\":50,\"type\":13},{\"gridX\":1044,\"gridY\":50,\"type\":13},{\"gridX\":2832,\"gridY\":50,\"type\":13},{\"gridX\":2440,\"gridY\":50,\"type\":13},{\"gridX\":5400,\"gridY\":50,\"type\":13},{\"gridX\":5528,\"gridY\":50,\"type\":13},{\"gridX\":276,\"gridY\":50,\"type\":13},{\"gridX\":404,\"gridY\":50,\"type\":13},{\"gridX\":2704,\"gridY\":50,\"type\":13},{\"gridX\":640,\"gridY\":50,\"type\":13},{\"gridX\":4264,\"gridY\":50,\"type\":13},{\"gridX\":1868,\"gridY\":50,\"type\":13},{\"gridX\":2960,\"gridY\":50,\"type\":13},{\"gridX\":3616,\"gridY\":50,\"type\":13},{\"gridX\":1172,\"gridY\":50,\"type\":13},{\"gridX\":4392,\"gridY\":50,\"type\":13},{\"gridX\":1564,\"gridY\":50,\"type\":13},{\"gridX\":5744,\"gridY\":50,\"type\":14},{\"gridX\":5336,\"gridY\":50,\"type\":14},{\"gridX\":2028,\"gridY\":50,\"type\":14},{\"gridX\":4200,\"gridY\":50,\"type\":14},{\"gridX\":924,\"gridY\":50,\"type\":14},{\"gridX\":4768,\"gridY\":50,\"type\":14},{\"gridX\":2124,\"gridY\":50,\"type\":14},{\"gridX\":768,\"gridY\":50,\"type\":14},{\"gridX\":4252,\"gridY\":48,\"type\":15},{\"gridX\":136,\"gridY\":48,\"type\":15},{\"gridX\":5200,\"gridY\":48,\"type\":15},{\"gridX\":5829,\"gridY\":48,\"type\":15},{\"gridX\":4060,\"gridY\":48,\"type\":15},{\"gridX\":1424,\"gridY\":48,\"type\":15},{\"gridX\":2236,\"gridY\":48,\"type\":15},{\"gridX\":968,\"gridY\":48,\"type\":15},{\"gridX\":2692,\"gridY\":48,\"type\":15},{\"gridX\":4820,\"gridY\":48,\"type\":15},{\"gridX\":3604,\"gridY\":48,\"type\":15},{\"gridX\":4636,\"gridY\":48,\"type\":15},{\"gridX\":5388,\"gridY\":48,\"type\":15},{\"gridX\":3484,\"gridY\":48,\"type\":15},{\"gridX\":4644,\"gridY\":48,\"type\":17},{\"gridX\":5208,\"gridY\":48,\"type\":17},{\"gridX\":3492,\"gridY\":48,\"type\":17},{\"gridX\":2372,\"gridY\":48,\"type\":17},{\"gridX\":3740,\"gridY\":48,\"type\":17},{\"gridX\":4068,\"gridY\":48,\"type\":17},{\"gridX\":976,\"gridY\":48,\"type\":17},{\"gridX\":4388,\"gridY\":48,\"type\":18},{\"gridX\":4828,\"gridY\":48,\"type\":18},{\"gridX\":4956,\"gridY\":48,\"type\":18},{\"gridX\":1040,\"gridY\":48,\"type\":18},{\"gridX\":2244,\"gridY\":48,\"type\":18},{\"gridX\":5396,\"gridY\":48,\"type\":18},{\"gridX\":5524,\"gridY\":48,\"type\":18},{\"gridX\":2436,\"gridY\":48,\"type\":18},{\"gridX\":4260,\"gridY\":48,\"type\":18},{\"gridX\":400,\"gridY\":48,\"type\":18},{\"gridX\":1688,\"gridY\":48,\"type\":18},{\"gridX\":3612,\"gridY\":48,\"type\":18},{\"gridX\":3804,\"gridY\":48,\"type\":18},{\"gridX\":1432,\"gridY\":48,\"type\":18},{\"gridX\":144,\"gridY\":48,\"type\":18},{\"gridX\":1560,\"gridY\":48,\"type\":18},{\"gridX\":2956,\"gridY\":48,\"type\":18},{\"gridX\":272,\"gridY\":48,\"type\":18},{\"gridX\":2700,\"gridY\":48,\"type\":18},{\"gridX\":1168,\"gridY\":48,\"type\":18},{\"gridX\":2828,\"gridY\":48,\"type\":18},{\"gridX\":3556,\"gridY\":48,\"type\":19},{\"gridX\":528,\"gridY\":48,\"type\":19},{\"gridX\":4132,\"gridY\":48,\"type\":19},{\"gridX\":3084,\"gridY\":48,\"type\":19},{\"gridX\":1816,\"gridY\":48,\"type\":19},{\"gridX\":1296,\"gridY\":48,\"type\":19},{\"gridX\":4708,\"gridY\":48,\"type\":19},{\"gridX\":3932,\"gridY\":48,\"type\":19},{\"gridX\":4516,\"gridY\":48,\"type\":19},{\"gridX\":5272,\"gridY\":48,\"type\":19},{\"gridX\":5652,\"gridY\":48,\"type\":19},{\"gridX\":5084,\"gridY\":48,\"type\":19},{\"gridX\":5836,\"gridY\":48,\"type\":19},{\"gridX\":2564,\"gridY\":48,\"type\":19},{\"gridX\":0,\"gridY\":90,\"type\":20},{\"gridX\":3784,\"gridY\":90,\"type\":22},{\"gridX\":5640,\"gridY\":90,\"type\":22},{\"gridX\":2440,\"gridY\":90,\"type\":22},{\"gridX\":1544,\"gridY\":90,\"type\":23},{\"gridX\":3656,\"gridY\":90,\"type\":23},{\"gridX\":3848,\"gridY\":90,\"type\":23},{\"gridX\":2312,\"gridY\":90,\"type\":23},{\"gridX\":2632,\"gridY\":90,\"type\":23},{\"gridX\":1672,\"gridY\":90,\"type\":23},{\"gridX\":4104,\"gridY\":90,\"type\":23},{\"gridX\":3976,\"gridY\":90,\"type\":23},{\"gridX\":5256,\"gridY\":90,\"type\":23},{\"gridX\":3528,\"gridY\":90,\"type\":23},{\"gridX\":1416,\"gridY\":90,\"type\":23},{\"gridX\":1160,\"gridY\":90,\"type\":23},{\"gridX\":2504,\"gridY\":90,\"type\":23},{\"gridX\":4616,\"gridY\":90,\"type\":23},{\"gridX\":2760,\"gridY\":90,\"type\":23},{\"gridX\":4744,\"gridY\":90,\"type\":23},{\"gridX\":4232,\"gridY\":90,\"type\":23},{\"gridX\":4360,\"gridY\":90,\"type\":23},{\"gridX\":5128,\"gridY\":90,\"type\":23},{\"gridX\":8,\"gridY\":90,\"type\":23},{\"gridX\":4488,\"gridY\":90,\"type\":23},{\"gridX\":2056,\"gridY\":90,\"type\":23},{\"gridX\":264,\"gridY\":90,\"type\":23},{\"gridX\":3272,\"gridY\":90,\"type\":23},{\"gridX\":5384,\"gridY\":90,\"type\":23},{\"gridX\":3016,\"gridY\":90,\"type\":23},{\"gridX\":136,\"gridY\":90,\"type\":23},{\"gridX\":2888,\"gridY\":90,\"type\":23},{\"gridX\":2184,\"gridY\":90,\"type\":23},{\"gridX\":3400,\"gridY\":90,\"type\":23},{\"gridX\":1928,\"gridY\":90,\"type\":23},{\"gridX\":1800,\"gridY\":90,\"type\":23},{\"gridX\":392,\"gridY\":90,\"type\":23},{\"gridX\":520,\"gridY\":90,\"type\":23},{\"gridX\":648,\"gridY\":90,\"type\":23},{\"gridX\":776,\"gridY\":90,\"type\":23},{\"gridX\":904,\"gridY\":90,\"type\":23},{\"gridX\":1032,\"gridY\":90,\"type" << "\":23},{\"gridX\":4872,\"gridY\":90,\"type\":23},{\"gridX\":1288,\"gridY\":90,\"type\":23},{\"gridX\":3144,\"gridY\":90,\"type\":23},{\"gridX\":5704,\"gridY\":90,\"type\":23},{\"gridX\":5000,\"gridY\":90,\"type\":23},{\"gridX\":5512,\"gridY\":90,\"type\":23},{\"gridX\":5856,\"gridY\":0,\"type\":25},{\"gridX\":5864,\"gridY\":0,\"type\":28},{\"gridX\":5992,\"gridY\":0,\"type\":28},{\"gridX\":6120,\"gridY\":0,\"type\":28},{\"gridX\":6248,\"gridY\":0,\"type\":29}],\"pits\":[],\"exitGrounds\":[{\"gridX\":5832,\"gridY\":88,\"type\":0}],\"holes\":[{\"gridX\":120,\"gridY\":80,\"type\":3}],\"foregroundObjects\":[{\"gridX\":1428,\"gridY\":75,\"type\":27},{\"gridX\":1428,\"gridY\":84,\"type\":30},{\"gridX\":1384,\"gridY\":48,\"type\":34},{\"gridX\":1400,\"gridY\":60,\"type\":34},{\"gridX\":1412,\"gridY\":52,\"type\":34},{\"gridX\":1320,\"gridY\":56,\"type\":34},{\"gridX\":1308,\"gridY\":48,\"type\":34},{\"gridX\":1332,\"gridY\":48,\"type\":34},{\"gridX\":140,\"gridY\":84,\"type\":30},{\"gridX\":140,\"gridY\":75,\"type\":27},{\"gridX\":176,\"gridY\":84,\"type\":30},{\"gridX\":176,\"gridY\":75,\"type\":27},{\"gridX\":212,\"gridY\":84,\"type\":30},{\"gridX\":212,\"gridY\":75,\"type\":27},{\"gridX\":2240,\"gridY\":75,\"type\":27},{\"gridX\":2240,\"gridY\":84,\"type\":30},{\"gridX\":3120,\"gridY\":48,\"type\":3},{\"gridX\":3124,\"gridY\":48,\"type\":4},{\"gridX\":3138,\"gridY\":48,\"type\":4},{\"gridX\":3152,\"gridY\":48,\"type\":5},{\"gridX\":3220,\"gridY\":48,\"type\":3},{\"gridX\":3224,\"gridY\":48,\"type\":4},{\"gridX\":1896,\"gridY\":70,\"type\":3},{\"gridX\":1900,\"gridY\":70,\"type\":4},{\"gridX\":1914,\"gridY\":70,\"type\":5},{\"gridX\":1976,\"gridY\":70,\"type\":3},{\"gridX\":1980,\"gridY\":70,\"type\":4},{\"gridX\":1994,\"gridY\":70,\"type\":5},{\"gridX\":2576,\"gridY\":48,\"type\":34},{\"gridX\":2600,\"gridY\":48,\"type\":34},{\"gridX\":2588,\"gridY\":56,\"type\":34},{\"gridX\":2652,\"gridY\":48,\"type\":34},{\"gridX\":2664,\"gridY\":64,\"type\":34},{\"gridX\":2676,\"gridY\":56,\"type\":34},{\"gridX\":3238,\"gridY\":48,\"type\":4},{\"gridX\":3252,\"gridY\":48,\"type\":5},{\"gridX\":2232,\"gridY\":59,\"type\":32},{\"gridX\":2696,\"gridY\":84,\"type\":30},{\"gridX\":2696,\"gridY\":75,\"type\":27},{\"gridX\":3320,\"gridY\":48,\"type\":3},{\"gridX\":3324,\"gridY\":48,\"type\":4},{\"gridX\":3338,\"gridY\":48,\"type\":4},{\"gridX\":3352,\"gridY\":48,\"type\":5},{\"gridX\":3608,\"gridY\":75,\"type\":27},{\"gridX\":3608,\"gridY\":84,\"type\":30},{\"gridX\":3944,\"gridY\":48,\"type\":34},{\"gridX\":3968,\"gridY\":48,\"type\":34},{\"gridX\":3956,\"gridY\":56,\"type\":34},{\"gridX\":4020,\"gridY\":48,\"type\":34},{\"gridX\":4036,\"gridY\":60,\"type\":34},{\"gridX\":4048,\"gridY\":52,\"type\":34},{\"gridX\":4064,\"gridY\":75,\"type\":27},{\"gridX\":4064,\"gridY\":84,\"type\":30},{\"gridX\":4256,\"gridY\":84,\"type\":30},{\"gridX\":4256,\"gridY\":75,\"type\":27},{\"gridX\":4632,\"gridY\":58,\"type\":32},{\"gridX\":4640,\"gridY\":84,\"type\":30},{\"gridX\":4640,\"gridY\":75,\"type\":27},{\"gridX\":5932,\"gridY\":96,\"type\":12},{\"gridX\":1812,\"gridY\":24,\"type\":3},{\"gridX\":1830,\"gridY\":24,\"type\":5},{\"gridX\":1816,\"gridY\":24,\"type\":4},{\"gridX\":3420,\"gridY\":48,\"type\":3},{\"gridX\":3424,\"gridY\":48,\"type\":4},{\"gridX\":3438,\"gridY\":48,\"type\":5},{\"gridX\":5844,\"gridY\":7,\"type\":20},{\"gridX\":4264,\"gridY\":44,\"type\":30},{\"gridX\":4300,\"gridY\":44,\"type\":30},{\"gridX\":4336,\"gridY\":44,\"type\":30},{\"gridX\":4372,\"gridY\":44,\"type\":30},{\"gridX\":4408,\"gridY\":44,\"type\":30},{\"gridX\":4444,\"gridY\":44,\"type\":30},{\"gridX\":4480,\"gridY\":44,\"type\":30},{\"gridX\":4740,\"gridY\":44,\"type\":30},{\"gridX\":4832,\"gridY\":44,\"type\":30},{\"gridX\":4824,\"gridY\":84,\"type\":30},{\"gridX\":4824,\"gridY\":75,\"type\":27},{\"gridX\":4868,\"gridY\":44,\"type\":30},{\"gridX\":4904,\"gridY\":44,\"type\":30},{\"gridX\":4940,\"gridY\":44,\"type\":30},{\"gridX\":4976,\"gridY\":44,\"type\":30},{\"gridX\":5012,\"gridY\":44,\"type\":30},{\"gridX\":5048,\"gridY\":44,\"type\":30},{\"gridX\":5308,\"gridY\":44,\"type\":30},{\"gridX\":5204,\"gridY\":84,\"type\":30},{\"gridX\":5204,\"gridY\":75,\"type\":27},{\"gridX\":5196,\"gridY\":58,\"type\":32},{\"gridX\":5392,\"gridY\":84,\"type\":30},{\"gridX\":5392,\"gridY\":75,\"type\":27},{\"gridX\":5400,\"gridY\":44,\"type\":30},{\"gridX\":5436,\"gridY\":44,\"type\":30},{\"gridX\":5472,\"gridY\":44,\"type\":30},{\"gridX\":5508,\"gridY\":44,\"type\":30},{\"gridX\":5544,\"gridY\":44,\"type\":30},{\"gridX\":5580,\"gridY\":44,\"type\":30},{\"gridX\":5616,\"gridY\":44,\"type\":30},{\"gridX\":4513,\"gridY\":44,\"type\":28},{\"gridX\":5081,\"gridY\":44,\"type\":28},{\"gridX\":5649,\"gridY\":44,\"type\":28},{\"gridX\":552,\"gridY\":24,\"type\":3},{\"gridX\":556,\"gridY\":24,\"type\":4},{\"gridX\":570,\"gridY\":24,\"type\":4},{\"gridX\":584,\"gridY\":24,\"type\":5},{\"gridX\":804,\"gridY\":38,\"type\":4},{\"gridX\":800,\"gridY\":38,\"type\":3},{\"gridX\":818,\"gridY\":38,\"type\":5},{\"gridX\":972,\"gridY\":75,\"type\":27},{\"gridX\":972,\"gridY\":84,\"type\":30},{\"gridX\":628,\"gridY\":84,\"type\":30},{\"gridX\":752,\"gridY\":84,\"type\":30},{\"gridX\":848,\"gridY\":84,\"type\":30},{\"gridX\":908,\"gridY\":84,\"type\":30},{\"gridX\":3480,\"gridY\":59,\"type\":32},{\"gridX\":3174,\"gridY\":84,\"type\":30},{\"gridX\":3274,\"gridY\":84,\"type\":30},{\"gridX\":3374,\"gridY\":84,\"type\":30},{\"gridX\":185,\"gridY\":127,\"type\":61},{\"gridX\":227,\"gridY\":127,\"type\":63},{\"gridX\":207,\"gridY\":127,\"type\":61},{\"gridX\":227,\"gridY\":140,\"type\":59},{\"gridX\":223,\"gridY\":149,\"type\":59},{\"gridX\":217,\"gridY\":157,\"type\":63},{\"gridX\":212,\"gridY\":167,\"type\":59},{\"gridX\":222,\"gridY\":172,\"type\":63},{\"gridX\":199,\"gridY\":165,\"type\":59},{\"gridX\":189,\"gridY\":169,\"type\":60},{\"gridX\":207,\"gridY\":178,\"type\":59},{\"gridX\":216,\"gridY\":187,\"type\":63},{\"gridX\":216,\"gridY\":198,\"type\":59}],\"midBossForegroundObjects\":[],\"endBossForegroundObjects\":[{\"gridX\":1432,\"gridY\":7,\"type\":45},{\"gridX\":1345,\"gridY\":66,\"type\":44},{\"gridX\":2700,\"gridY\":7,\"type\":45},{\"gridX\":2613,\"gridY\":66,\"type\":44},{\"gridX\":4184,\"gridY\":55,\"type\":43},{\"gridX\":4068,\"gridY\":7,\"type\":45},{\"gridX\":3981,\"gridY\":66,\"type\":44},{\"gridX\":4568,\"gridY\":55,\"type\":42},{\"gridX\":4752,\"gridY\":55,\"type\":43},{\"gridX\":5136,\"gridY\":55,\"type\":42},{\"gridX\":5320,\"gridY\":55,\"type\":43},{\"gridX\":5704,\"gridY\":55,\"type\":42}],\"countHissWithMinas\":[{\"gridX\":182,\"gridY\":132}],\"endBossSnakes\":[{\"gridX\":232,\"gridY\":96}],\"enemies\":[],\"collectibles\":[{\"gridX\":1828,\"gridY\":40,\"type\":0},{\"gridX\":1836,\"gridY\":48,\"type\":0},{\"gridX\":1408,\"gridY\":16,\"type\":0},{\"gridX\":1416,\"gridY\":16,\"type\":0},{\"gridX\":1400,\"gridY\":16,\"type\":0},{\"gridX\":300,\"gridY\":16,\"type\":0},{\"gridX\":284,\"gridY\":16,\"type\":0},{\"gridX\":292,\"gridY\":16,\"type\":0},{\"gridX\":1208,\"gridY\":16,\"type\":0},{\"gridX\":1192,\"gridY\":16,\"type\":0},{\"gridX\":1200,\"gridY\":16,\"type\":0},{\"gridX\":1572,\"gridY\":16,\"type\":0},{\"gridX\":1728,\"gridY\":16,\"type\":0},{\"gridX\":1580,\"gridY\":16,\"type\":0},{\"gridX\":1588,\"gridY\":16,\"type\":0},{\"gridX\":1720,\"gridY\":16,\"type\":0},{\"gridX\":1712,\"gridY\":16,\"type\":0},{\"gridX\":1868,\"gridY\":64,\"type\":0},{\"gridX\":1908,\"gridY\":80,\"type\":0},{\"gridX\":1944,\"gridY\":64,\"type\":0},{\"gridX\":1980,\"gridY\":80,\"type\":0},{\"gridX\":2221,\"gridY\":76,\"type\":1},{\"gridX\":3556,\"gridY\":80,\"type\":1},{\"gridX\":2308,\"gridY\":16,\"type\":0},{\"gridX\":2316,\"gridY\":16,\"type\":0},{\"gridX\":2300,\"gridY\":16,\"type\":0},{\"gridX\":2472,\"gridY\":16,\"type\":0},{\"gridX\":2480,\"gridY\":16,\"type\":0},{\"gridX\":2488,\"gridY\":16,\"type\":0},{\"gridX\":2668,\"gridY\":16,\"type\":0},{\"gridX\":2676,\"gridY\":16,\"type\":0},{\"gridX\":2684,\"gridY\":16,\"type\":0},{\"gridX\":" << "3128,\"gridY\":60,\"type\":0},{\"gridX\":3136,\"gridY\":60,\"type\":0},{\"gridX\":3144,\"gridY\":60,\"type\":0},{\"gridX\":3228,\"gridY\":60,\"type\":0},{\"gridX\":3236,\"gridY\":60,\"type\":0},{\"gridX\":3244,\"gridY\":60,\"type\":0},{\"gridX\":3328,\"gridY\":60,\"type\":0},{\"gridX\":3336,\"gridY\":60,\"type\":0},{\"gridX\":3344,\"gridY\":60,\"type\":0},{\"gridX\":2864,\"gridY\":16,\"type\":0},{\"gridX\":2872,\"gridY\":16,\"type\":0},{\"gridX\":2880,\"gridY\":16,\"type\":0},{\"gridX\":3032,\"gridY\":16,\"type\":0},{\"gridX\":3040,\"gridY\":16,\"type\":0},{\"gridX\":3048,\"gridY\":16,\"type\":0},{\"gridX\":3176,\"gridY\":44,\"type\":0},{\"gridX\":3184,\"gridY\":40,\"type\":0},{\"gridX\":3192,\"gridY\":44,\"type\":0},{\"gridX\":3276,\"gridY\":44,\"type\":0},{\"gridX\":3284,\"gridY\":40,\"type\":0},{\"gridX\":3292,\"gridY\":44,\"type\":0},{\"gridX\":3664,\"gridY\":16,\"type\":0},{\"gridX\":3672,\"gridY\":16,\"type\":0},{\"gridX\":3680,\"gridY\":16,\"type\":0},{\"gridX\":4052,\"gridY\":16,\"type\":0},{\"gridX\":4044,\"gridY\":16,\"type\":0},{\"gridX\":4036,\"gridY\":16,\"type\":0},{\"gridX\":4340,\"gridY\":16,\"type\":0},{\"gridX\":4348,\"gridY\":16,\"type\":0},{\"gridX\":4356,\"gridY\":16,\"type\":0},{\"gridX\":4684,\"gridY\":16,\"type\":0},{\"gridX\":4676,\"gridY\":16,\"type\":0},{\"gridX\":4668,\"gridY\":16,\"type\":0},{\"gridX\":4940,\"gridY\":16,\"type\":0},{\"gridX\":4924,\"gridY\":16,\"type\":0},{\"gridX\":4932,\"gridY\":16,\"type\":0},{\"gridX\":5236,\"gridY\":16,\"type\":0},{\"gridX\":5228,\"gridY\":16,\"type\":0},{\"gridX\":5220,\"gridY\":16,\"type\":0},{\"gridX\":2048,\"gridY\":48,\"type\":0},{\"gridX\":2056,\"gridY\":44,\"type\":0},{\"gridX\":2064,\"gridY\":48,\"type\":0},{\"gridX\":3376,\"gridY\":44,\"type\":0},{\"gridX\":3384,\"gridY\":40,\"type\":0},{\"gridX\":3392,\"gridY\":44,\"type\":0},{\"gridX\":5836,\"gridY\":80,\"type\":1},{\"gridX\":3872,\"gridY\":16,\"type\":0},{\"gridX\":3880,\"gridY\":16,\"type\":0},{\"gridX\":3888,\"gridY\":16,\"type\":0},{\"gridX\":5552,\"gridY\":16,\"type\":0},{\"gridX\":5560,\"gridY\":16,\"type\":0},{\"gridX\":5568,\"gridY\":16,\"type\":0},{\"gridX\":468,\"gridY\":16,\"type\":0},{\"gridX\":476,\"gridY\":16,\"type\":0},{\"gridX\":484,\"gridY\":16,\"type\":0},{\"gridX\":688,\"gridY\":64,\"type\":0},{\"gridX\":704,\"gridY\":64,\"type\":0},{\"gridX\":696,\"gridY\":64,\"type\":0},{\"gridX\":808,\"gridY\":52,\"type\":0},{\"gridX\":880,\"gridY\":64,\"type\":0},{\"gridX\":888,\"gridY\":64,\"type\":0},{\"gridX\":896,\"gridY\":64,\"type\":0},{\"gridX\":600,\"gridY\":52,\"type\":0},{\"gridX\":592,\"gridY\":48,\"type\":0},{\"gridX\":608,\"gridY\":56,\"type\":0},{\"gridX\":2096,\"gridY\":64,\"type\":0},{\"gridX\":2104,\"gridY\":64,\"type\":0},{\"gridX\":2112,\"gridY\":64,\"type\":0},{\"gridX\":1040,\"gridY\":16,\"type\":0},{\"gridX\":1048,\"gridY\":16,\"type\":0},{\"gridX\":1056,\"gridY\":16,\"type\":0},{\"gridX\":3428,\"gridY\":56,\"type\":3},{\"gridX\":3569,\"gridY\":70,\"type\":2},{\"gridX\":5814,\"gridY\":60,\"type\":3}],\"jons\":[{\"gridX\":12,\"gridY\":104}],\"extraForegroundObjects\":[],\"foregroundCoverObjects\":[],\"markers\":[]}";
-    
-    static std::string text = ss.str();
-    
-    s_pInstance = new Chapter1Level21(text.c_str());
+    s_pInstance = new Chapter1Level21();
 }
 
 void Chapter1Level21::destroy()
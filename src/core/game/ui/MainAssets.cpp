@@ -1793,118 +1793,48 @@ TextureRegion& MainAssets::get(Jon* jon)
     
     if (jon->isVampire())
     {
-        static Animation deathAnim = ASSETS->findAnimation("Jon_Vampire_Death");
-        static Animation pushedBackAnim = ASSETS->findAnimation("Jon_Vampire_PushedBack");
-        static Animation idleAnim = ASSETS->findAnimation("Jon_Vampire_Idle");
-        static Animation runningAnim = ASSETS->findAnimation("Jon_Vampire_Running");
-        static Animation upwardThrustAnim = ASSETS->findAnimation("Jon_Vampire_UpwardThrust");
-        static Animation dashAnim = ASSETS->findAnimation("Jon_Vampire_Dash");
-        static Animation doubleJumpingAnim = ASSETS->findAnimation("Jon_Vampire_DoubleJumping");
-        static Animation glidingAnim = ASSETS->findAnimation("Jon_Vampire_Gliding");
-        static Animation fallingAnim = ASSETS->findAnimation("Jon_Vampire_Falling");
-        static Animation landingAnim = ASSETS->findAnimation("Jon_Vampire_Landing");
-        static Animation ledgeGrabAnim = ASSETS->findAnimation("Jon_Vampire_LedgeGrab");
+        JonAfterImage pose;
+        jon->captureAfterImage(pose);
         
-        if (jon->getState() != JON_ALIVE)
-        {
-            return deathAnim.getTextureRegion(jon->getDyingStateTime());
-        }
+        int runningKeyFrameNumber;
+        TextureRegion& ret = getVampire(pose, runningKeyFrameNumber);
         
-        switch (jon->getAbilityState())
-        {
-            case ABILITY_GLIDE:
-                return glidingAnim.getTextureRegion(jon->getAbilityStateTime());
-            case ABILITY_UPWARD_THRUST:
-                return upwardThrustAnim.getTextureRegion(jon->getActionStateTime());
-            case ABILITY_DASH:
-                if (jon->getAbilityStateTime() > 0.5f && jon->isFalling())
-                {
-                    return fallingAnim.getTextureRegion(jon->getStateTime());
-                }
-                
-                return dashAnim.getTextureRegion(jon->getAbilityStateTime());
-            case ABILITY_NONE:
-            default:
-                break;
-        }
-        
-        if (jon->getPhysicalState() == PHYSICAL_GROUNDED)
+        if (runningKeyFrameNumber == 1 && !jon->isRightFoot())
         {
-            if (jon->isLanding())
+            jon->setRightFoot(true);
+            
+            if (jon->getGroundSoundType() == GROUND_SOUND_ID_GRASS)
             {
-                return landingAnim.getTextureRegion(jon->getStateTime());
+                NG_AUDIO_ENGINE->playSound(SOUND_ID_FOOTSTEP_RIGHT_GRASS);
             }
-        }
-        else if (jon->getPhysicalState() == PHYSICAL_IN_AIR)
-        {
-            if (jon->isClimbingLedge())
+            else if (jon->getGroundSoundType() == GROUND_SOUND_ID_CAVE)
             {
-                return ledgeGrabAnim.getTextureRegion(jon->getStateTime());
+                NG_AUDIO_ENGINE->playSound(SOUND_ID_FOOTSTEP_RIGHT_CAVE);
             }
-            
-            if (jon->isFalling())
+            else if (jon->getGroundSoundType() == GROUND_SOUND_ID_WOOD)
             {
-                return fallingAnim.getTextureRegion(jon->getStateTime());
+                NG_AUDIO_ENGINE->playSound(SOUND_ID_FOOTSTEP_RIGHT_WOOD);
             }
         }
-        
-        switch (jon->getActionState())
-        {
-            case ACTION_JUMPING:
-            case ACTION_DOUBLE_JUMPING:
-                return doubleJumpingAnim.getTextureRegion(jon->getActionStateTime());
-            case ACTION_NONE:
-            default:
-                break;
-        }
-        
-        if (jon->isMoving())
+        else if (runningKeyFrameNumber == 7 && jon->isRightFoot())
         {
-            int keyFrameNumber = runningAnim.getKeyFrameNumber(jon->getStateTime());
+            jon->setRightFoot(false);
             
-            if (keyFrameNumber == 1 && !jon->isRightFoot())
+            if (jon->getGroundSoundType() == GROUND_SOUND_ID_GRASS)
             {
-                jon->setRightFoot(true);
-                
-                if (jon->getGroundSoundType() == GROUND_SOUND_ID_GRASS)
-                {
-                    NG_AUDIO_ENGINE->playSound(SOUND_ID_FOOTSTEP_RIGHT_GRASS);
-                }
-                else if (jon->getGroundSoundType() == GROUND_SOUND_ID_CAVE)
-                {
-                    NG_AUDIO_ENGINE->playSound(SOUND_ID_FOOTSTEP_RIGHT_CAVE);
-                }
-                else if (jon->getGroundSoundType() == GROUND_SOUND_ID_WOOD)
-                {
-                    NG_AUDIO_ENGINE->playSound(SOUND_ID_FOOTSTEP_RIGHT_WOOD);
-                }
+                NG_AUDIO_ENGINE->playSound(SOUND_ID_FOOTSTEP_LEFT_GRASS);
             }
-            else if (keyFrameNumber == 7 && jon->isRightFoot())
+            else if (jon->getGroundSoundType() == GROUND_SOUND_ID_CAVE)
             {
-                jon->setRightFoot(false);
-                
-                if (jon->getGroundSoundType() == GROUND_SOUND_ID_GRASS)
-                {
-                    NG_AUDIO_ENGINE->playSound(SOUND_ID_FOOTSTEP_LEFT_GRASS);
-                }
-                else if (jon->getGroundSoundType() == GROUND_SOUND_ID_CAVE)
-                {
-                    NG_AUDIO_ENGINE->playSound(SOUND_ID_FOOTSTEP_LEFT_CAVE);
-                }
-                else if (jon->getGroundSoundType() == GROUND_SOUND_ID_WOOD)
-                {
-                    NG_AUDIO_ENGINE->playSound(SOUND_ID_FOOTSTEP_LEFT_WOOD);
-                }
+                NG_AUDIO_ENGINE->playSound(SOUND_ID_FOOTSTEP_LEFT_CAVE);
+            }
+            else if (jon->getGroundSoundType() == GROUND_SOUND_ID_WOOD)
+            {
+                NG_AUDIO_ENGINE->playSound(SOUND_ID_FOOTSTEP_LEFT_WOOD);
             }
-            
-            return runningAnim.getTextureRegion(keyFrameNumber);
-        }
-        else if (jon->isPushedBack())
-        {
-            return pushedBackAnim.getTextureRegion(jon->getStateTime());
         }
         
-        return idleAnim.getTextureRegion(jon->getStateTime());
+        return ret;
     }
     else
     {
@@ -2024,6 +1954,13 @@ TextureRegion& MainAssets::get(Jon* jon)
     }
 }
 
+TextureRegion& MainAssets::get(JonAfterImage* afterImage)
+{
+    int runningKeyFrameNumber;
+    
+    return getVampire(*afterImage, runningKeyFrameNumber);
+}
+
 TextureRegion& MainAssets::get(DustCloud* dustCloud)
 {
     switch (dustCloud->getType())
@@ -2484,6 +2421,91 @@ void MainAssets::setUsingGamePadTextureSet(bool isUsingGamePadTextureSet)
     m_isUsingGamePadTextureSet = isUsingGamePadTextureSet;
 }
 
+#pragma mark private
+
+TextureRegion& MainAssets::getVampire(JonAfterImage& pose, int& runningKeyFrameNumber)
+{
+    static Animation deathAnim = ASSETS->findAnimation("Jon_Vampire_Death");
+    static Animation pushedBackAnim = ASSETS->findAnimation("Jon_Vampire_PushedBack");
+    static Animation idleAnim = ASSETS->findAnimation("Jon_Vampire_Idle");
+    static Animation runningAnim = ASSETS->findAnimation("Jon_Vampire_Running");
+    static Animation upwardThrustAnim = ASSETS->findAnimation("Jon_Vampire_UpwardThrust");
+    static Animation dashAnim = ASSETS->findAnimation("Jon_Vampire_Dash");
+    static Animation doubleJumpingAnim = ASSETS->findAnimation("Jon_Vampire_DoubleJumping");
+    static Animation glidingAnim = ASSETS->findAnimation("Jon_Vampire_Gliding");
+    static Animation fallingAnim = ASSETS->findAnimation("Jon_Vampire_Falling");
+    static Animation landingAnim = ASSETS->findAnimation("Jon_Vampire_Landing");
+    static Animation ledgeGrabAnim = ASSETS->findAnimation("Jon_Vampire_LedgeGrab");
+    
+    runningKeyFrameNumber = -1;
+    
+    if (pose.state != JON_ALIVE)
+    {
+        return deathAnim.getTextureRegion(pose.dyingStateTime);
+    }
+    
+    switch (pose.abilityState)
+    {
+        case ABILITY_GLIDE:
+            return glidingAnim.getTextureRegion(pose.abilityStateTime);
+        case ABILITY_UPWARD_THRUST:
+            return upwardThrustAnim.getTextureRegion(pose.actionStateTime);
+        case ABILITY_DASH:
+            if (pose.abilityStateTime > 0.5f && pose.velocityY < 0)
+            {
+                return fallingAnim.getTextureRegion(pose.stateTime);
+            }
+            
+            return dashAnim.getTextureRegion(pose.abilityStateTime);
+        case ABILITY_NONE:
+        default:
+            break;
+    }
+    
+    if (pose.physicalState == PHYSICAL_GROUNDED)
+    {
+        if (pose.isLanding)
+        {
+            return landingAnim.getTextureRegion(pose.stateTime);
+        }
+    }
+    else if (pose.physicalState == PHYSICAL_IN_AIR)
+    {
+        if (pose.isClimbingLedge)
+        {
+            return ledgeGrabAnim.getTextureRegion(pose.stateTime);
+        }
+        
+        if (pose.velocityY < 0)
+        {
+            return fallingAnim.getTextureRegion(pose.stateTime);
+        }
+    }
+    
+    switch (pose.actionState)
+    {
+        case ACTION_JUMPING:
+        case ACTION_DOUBLE_JUMPING:
+            return doubleJumpingAnim.getTextureRegion(pose.actionStateTime);
+        case ACTION_NONE:
+        default:
+            break;
+    }
+    
+    if (pose.velocityX > 0)
+    {
+        runningKeyFrameNumber = runningAnim.getKeyFrameNumber(pose.stateTime);
+        
+        return runningAnim.getTextureRegion(runningKeyFrameNumber);
+    }
+    else if (pose.velocityX < 0)
+    {
+        return pushedBackAnim.getTextureRegion(pose.stateTime);
+    }
+    
+    return idleAnim.getTextureRegion(pose.stateTime);
+}
+
 MainAssets::MainAssets() : m_isUsingCompressedTextureSet(false), m_isUsingDesktopTextureSet(false), m_isUsingGamePadTextureSet(false)
 {
     // Empty
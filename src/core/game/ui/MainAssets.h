@@ -21,6 +21,7 @@ class Hole;
 class HoleCover;
 class DustCloud;
 class Jon;
+struct JonAfterImage;
 class JonShadow;
 class MidBossOwl;
 class GameButton;
@@ -150,6 +151,9 @@ public:
     
     TextureRegion& get(Jon* jon);
     
+    // After-images are only ever left by the vampire
+    TextureRegion& get(JonAfterImage* afterImage);
+    
     TextureRegion& get(DustCloud* dustCloud);
     
     TextureRegion& get(JonShadow* jonShadow);
@@ -205,6 +209,9 @@ private:
     bool m_isUsingDesktopTextureSet;
     bool m_isUsingGamePadTextureSet;
     
+    // Shared by the vampire and his after-images, runningKeyFrameNumber stays -1 unless he is running
+    TextureRegion& getVampire(JonAfterImage& pose, int& runningKeyFrameNumber);
+    
     // ctor, copy ctor, and assignment should be private in a Singleton
     MainAssets();
     MainAssets(const MainAssets&);
@@ -261,75 +261,82 @@ void MainRenderer::releaseDeviceDependentResources()
 
 void MainRenderer::load(RendererType rendererType)
 {
-    m_tutorial->name = MAIN_ASSETS->isUsingGamePadTextureSet() ? TEX_GAMEPAD_TUTORIAL : MAIN_ASSETS->isUsingDesktopTextureSet() ? TEX_KEYBOARD_TUTORIAL : MAIN_ASSETS->isUsingCompressedTextureSet() ? TEX_COMPRESSED_TUTORIAL : TEX_TUTORIAL;
+    std::string tutorialName = MAIN_ASSETS->isUsingGamePadTextureSet() ? TEX_GAMEPAD_TUTORIAL : MAIN_ASSETS->isUsingDesktopTextureSet() ? TEX_KEYBOARD_TUTORIAL : MAIN_ASSETS->isUsingCompressedTextureSet() ? TEX_COMPRESSED_TUTORIAL : TEX_TUTORIAL;
+    if (m_tutorial->name != tutorialName)
+    {
+        // The input device changed, so a resident tutorial texture is stale
+        unloadTexture(m_tutorial);
+        
+        m_tutorial->name = tutorialName;
+    }
     
     switch (rendererType)
     {
         case RENDERER_TYPE_TITLE:
-            loadTextureAsync(m_title_screen);
+            acquireTexture(m_title_screen, rendererType);
             break;
         case RENDERER_TYPE_WORLD_MAP:
-            loadTextureAsync(m_world_map_screen_part_1);
-            loadTextureAsync(m_world_map_screen_part_2);
+            acquireTexture(m_world_map_screen_part_1, rendererType);
+            acquireTexture(m_world_map_screen_part_2, rendererType);
             break;
         case RENDERER_TYPE_LEVEL_EDITOR:
-            loadTextureAsync(m_level_editor);
+            acquireTexture(m_level_editor, rendererType);
             break;
             
         case RENDERER_TYPE_WORLD_1_CUTSCENE:
-            loadTextureAsync(m_world_1_cutscene_1);
-            loadTextureAsync(m_world_1_cutscene_2);
+            acquireTexture(m_world_1_cutscene_1, rendererType);
+            acquireTexture(m_world_1_cutscene_2, rendererType);
             break;
             
         case RENDERER_TYPE_WORLD_1:
-            loadTextureAsync(m_world_1_background_lower_part_1);
-            loadTextureAsync(m_world_1_background_lower_part_2);
-            loadTextureAsync(m_world_1_background_mid);
-            loadTextureAsync(m_world_1_background_upper);
-            loadTextureAsync(m_world_1_enemies);
-            loadTextureAsync(m_world_1_ground);
-            loadTextureAsync(m_world_1_objects_part_1);
-            loadTextureAsync(m_world_1_objects_part_2);
-            loadTextureAsync(m_world_1_special);
-            loadTextureAsync(m_jon);
-            loadTextureAsync(m_trans_death_shader_helper);
-            loadTextureAsync(m_vampire);
-            loadTextureAsync(m_tutorial);
+            acquireTexture(m_world_1_background_lower_part_1, rendererType);
+            acquireTexture(m_world_1_background_lower_part_2, rendererType);
+            acquireTexture(m_world_1_background_mid, rendererType);
+            acquireTexture(m_world_1_background_upper, rendererType);
+            acquireTexture(m_world_1_enemies, rendererType);
+            acquireTexture(m_world_1_ground, rendererType);
+            acquireTexture(m_world_1_objects_part_1, rendererType);
+            acquireTexture(m_world_1_objects_part_2, rendererType);
+            acquireTexture(m_world_1_special, rendererType);
+            acquireTexture(m_jon, rendererType);
+            acquireTexture(m_trans_death_shader_helper, rendererType);
+            acquireTexture(m_vampire, rendererType);
+            acquireTexture(m_tutorial, rendererType);
             break;
         case RENDERER_TYPE_WORLD_1_OBJECTS_PART_1:
-            loadTextureAsync(m_world_1_objects_part_1);
+            acquireTexture(m_world_1_objects_part_1, rendererType);
             break;
         case RENDERER_TYPE_WORLD_1_MID_BOSS:
-            loadTextureAsync(m_world_1_background_lower_part_1);
-            loadTextureAsync(m_world_1_background_lower_part_2);
-            loadTextureAsync(m_world_1_background_mid);
-            loadTextureAsync(m_world_1_background_upper);
-            loadTextureAsync(m_world_1_ground);
-            loadTextureAsync(m_world_1_objects_part_1);
-            loadTextureAsync(m_world_1_objects_part_2);
-            loadTextureAsync(m_jon);
-            loadTextureAsync(m_trans_death_shader_helper);
-            loadTextureAsync(m_vampire);
-            loadTextureAsync(m_tutorial);
-            loadTextureAsync(m_world_1_mid_boss_part_1);
-            loadTextureAsync(m_world_1_mid_boss_part_2);
-            loadTextureAsync(m_world_1_mid_boss_part_3);
+            acquireTexture(m_world_1_background_lower_part_1, rendererType);
+            acquireTexture(m_world_1_background_lower_part_2, rendererType);
+            acquireTexture(m_world_1_background_mid, rendererType);
+            acquireTexture(m_world_1_background_upper, rendererType);
+            acquireTexture(m_world_1_ground, rendererType);
+            acquireTexture(m_world_1_objects_part_1, rendererType);
+            acquireTexture(m_world_1_objects_part_2, rendererType);
+            acquireTexture(m_jon, rendererType);
+            acquireTexture(m_trans_death_shader_helper, rendererType);
+            acquireTexture(m_vampire, rendererType);
+            acquireTexture(m_tutorial, rendererType);
+            acquireTexture(m_world_1_mid_boss_part_1, rendererType);
+            acquireTexture(m_world_1_mid_boss_part_2, rendererType);
+            acquireTexture(m_world_1_mid_boss_part_3, rendererType);
             break;
         case RENDERER_TYPE_WORLD_1_END_BOSS:
-            loadTextureAsync(m_world_1_background_lower_part_1);
-            loadTextureAsync(m_world_1_background_lower_part_2);
-            loadTextureAsync(m_world_1_background_mid);
-            loadTextureAsync(m_world_1_background_upper);
-            loadTextureAsync(m_world_1_ground);
-            loadTextureAsync(m_world_1_objects_part_1);
-            loadTextureAsync(m_world_1_objects_part_2);
-            loadTextureAsync(m_jon);
-            loadTextureAsync(m_trans_death_shader_helper);
-            loadTextureAsync(m_vampire);
-            loadTextureAsync(m_tutorial);
-            loadTextureAsync(m_world_1_end_boss_part_1);
-            loadTextureAsync(m_world_1_end_boss_part_2);
-            loadTextureAsync(m_world_1_end_boss_part_3);
+            acquireTexture(m_world_1_background_lower_part_1, rendererType);
+            acquireTexture(m_world_1_background_lower_part_2, rendererType);
+            acquireTexture(m_world_1_background_mid, rendererType);
+            acquireTexture(m_world_1_background_upper, rendererType);
+            acquireTexture(m_world_1_ground, rendererType);
+            acquireTexture(m_world_1_objects_part_1, rendererType);
+            acquireTexture(m_world_1_objects_part_2, rendererType);
+            acquireTexture(m_jon, rendererType);
+            acquireTexture(m_trans_death_shader_helper, rendererType);
+            acquireTexture(m_vampire, rendererType);
+            acquireTexture(m_tutorial, rendererType);
+            acquireTexture(m_world_1_end_boss_part_1, rendererType);
+            acquireTexture(m_world_1_end_boss_part_2, rendererType);
+            acquireTexture(m_world_1_end_boss_part_3, rendererType);
             break;
 
 		case RENDERER_TYPE_NONE:
@@ -343,70 +350,70 @@ void MainRenderer::unload(RendererType rendererType)
     switch (rendererType)
     {
         case RENDERER_TYPE_TITLE:
-            unloadTexture(m_title_screen);
+            releaseTexture(m_title_screen, rendererType);
             break;
         case RENDERER_TYPE_WORLD_MAP:
-            unloadTexture(m_world_map_screen_part_1);
-            unloadTexture(m_world_map_screen_part_2);
+            releaseTexture(m_world_map_screen_part_1, rendererType);
+            releaseTexture(m_world_map_screen_part_2, rendererType);
             break;
         case RENDERER_TYPE_LEVEL_EDITOR:
-            unloadTexture(m_level_editor);
+            releaseTexture(m_level_editor, rendererType);
             break;
             
         case RENDERER_TYPE_WORLD_1_CUTSCENE:
-            unloadTexture(m_world_1_cutscene_1);
-            unloadTexture(m_world_1_cutscene_2);
+            releaseTexture(m_world_1_cutscene_1, rendererType);
+            releaseTexture(m_world_1_cutscene_2, rendererType);
             break;
             
         case RENDERER_TYPE_WORLD_1:
-            unloadTexture(m_world_1_background_lower_part_1);
-            unloadTexture(m_world_1_background_lower_part_2);
-            unloadTexture(m_world_1_background_mid);
-            unloadTexture(m_world_1_background_upper);
-            unloadTexture(m_world_1_enemies);
-            unloadTexture(m_world_1_ground);
-            unloadTexture(m_world_1_objects_part_1);
-            unloadTexture(m_world_1_objects_part_2);
-            unloadTexture(m_world_1_special);
-            unloadTexture(m_jon);
-            unloadTexture(m_trans_death_shader_helper);
-            unloadTexture(m_vampire);
-            unloadTexture(m_tutorial);
+            releaseTexture(m_world_1_background_lower_part_1, rendererType);
+            releaseTexture(m_world_1_background_lower_part_2, rendererType);
+            releaseTexture(m_world_1_background_mid, rendererType);
+            releaseTexture(m_world_1_background_upper, rendererType);
+            releaseTexture(m_world_1_enemies, rendererType);
+            releaseTexture(m_world_1_ground, rendererType);
+            releaseTexture(m_world_1_objects_part_1, rendererType);
+            releaseTexture(m_world_1_objects_part_2, rendererType);
+            releaseTexture(m_world_1_special, rendererType);
+            releaseTexture(m_jon, rendererType);
+            releaseTexture(m_trans_death_shader_helper, rendererType);
+            releaseTexture(m_vampire, rendererType);
+            releaseTexture(m_tutorial, rendererType);
             break;
         case RENDERER_TYPE_WORLD_1_OBJECTS_PART_1:
-            unloadTexture(m_world_1_objects_part_1);
+            releaseTexture(m_world_1_objects_part_1, rendererType);
             break;
         case RENDERER_TYPE_WORLD_1_MID_BOSS:
-            unloadTexture(m_world_1_background_lower_part_1);
-            unloadTexture(m_world_1_background_lower_part_2);
-            unloadTexture(m_world_1_background_mid);
-            unloadTexture(m_world_1_background_upper);
-            unloadTexture(m_world_1_ground);
-            unloadTexture(m_world_1_objects_part_1);
-            unloadTexture(m_world_1_objects_part_2);
-            unloadTexture(m_jon);
-            unloadTexture(m_trans_death_shader_helper);
-            unloadTexture(m_vampire);
-            unloadTexture(m_tutorial);
-            unloadTexture(m_world_1_mid_boss_part_1);
-            unloadTexture(m_world_1_mid_boss_part_2);
-            unloadTexture(m_world_1_mid_boss_part_3);
+            releaseTexture(m_world_1_background_lower_part_1, rendererType);
+            releaseTexture(m_world_1_background_lower_part_2, rendererType);
+            releaseTexture(m_world_1_background_mid, rendererType);
+            releaseTexture(m_world_1_background_upper, rendererType);
+            releaseTexture(m_world_1_ground, rendererType);
+            releaseTexture(m_world_1_objects_part_1, rendererType);
+            releaseTexture(m_world_1_objects_part_2, rendererType);
+            releaseTexture(m_jon, rendererType);
+            releaseTexture(m_trans_death_shader_helper, rendererType);
+            releaseTexture(m_vampire, rendererType);
+            releaseTexture(m_tutorial, rendererType);
+            releaseTexture(m_world_1_mid_boss_part_1, rendererType);
+            releaseTexture(m_world_1_mid_boss_part_2, rendererType);
+            releaseTexture(m_world_1_mid_boss_part_3, rendererType);
             break;
         case RENDERER_TYPE_WORLD_1_END_BOSS:
-            unloadTexture(m_world_1_background_lower_part_1);
-            unloadTexture(m_world_1_background_lower_part_2);
-            unloadTexture(m_world_1_background_mid);
-            unloadTexture(m_world_1_background_upper);
-            unloadTexture(m_world_1_ground);
-            unloadTexture(m_world_1_objects_part_1);
-            unloadTexture(m_world_1_objects_part_2);
-            unloadTexture(m_jon);
-            unloadTexture(m_trans_death_shader_helper);
-            unloadTexture(m_vampire);
-            unloadTexture(m_tutorial);
-            unloadTexture(m_world_1_end_boss_part_1);
-            unloadTexture(m_world_1_end_boss_part_2);
-            unloadTexture(m_world_1_end_boss_part_3);
+            releaseTexture(m_world_1_background_lower_part_1, rendererType);
+            releaseTexture(m_world_1_background_lower_part_2, rendererType);
+            releaseTexture(m_world_1_background_mid, rendererType);
+            releaseTexture(m_world_1_background_upper, rendererType);
+            releaseTexture(m_world_1_ground, rendererType);
+            releaseTexture(m_world_1_objects_part_1, rendererType);
+            releaseTexture(m_world_1_objects_part_2, rendererType);
+            releaseTexture(m_jon, rendererType);
+            releaseTexture(m_trans_death_shader_helper, rendererType);
+            releaseTexture(m_vampire, rendererType);
+            releaseTexture(m_tutorial, rendererType);
+            releaseTexture(m_world_1_end_boss_part_1, rendererType);
+            releaseTexture(m_world_1_end_boss_part_2, rendererType);
+            releaseTexture(m_world_1_end_boss_part_3, rendererType);
             break;
             
         case RENDERER_TYPE_NONE:
@@ -1076,14 +1083,14 @@ void MainRenderer::renderWorld(Game& game)
             {
                 PhysicalEntity& pe = fpo->getIdlePoof();
                 static Animation anim = ASSETS->findAnimation("FloatingPlatformIdlePoof");
-                TextureRegion tr = anim.getTextureRegion(pe.getStateTime());
+                TextureRegion& tr = anim.getTextureRegion(pe.getStateTime());
                 m_spriteBatcher->drawSprite(pe.getPosition().getX(), pe.getPosition().getY(), pe.getWidth(), pe.getHeight(), 0, tr);
             }
             else if (fpo->isWeighted())
             {
                 PhysicalEntity& pe = fpo->getAddedWeightPoof();
                 static Animation anim = ASSETS->findAnimation("FloatingPlatformWeightedPoof");
-                TextureRegion tr = anim.getTextureRegion(pe.getStateTime());
+                TextureRegion& tr = anim.getTextureRegion(pe.getStateTime());
                 m_spriteBatcher->drawSprite(pe.getPosition().getX(), pe.getPosition().getY(), pe.getWidth(), pe.getHeight(), 0, tr);
             }
         }
@@ -1170,11 +1177,10 @@ void MainRenderer::renderJonAndExtraForegroundObjects(Game& game)
         /// Render Jon After Images
         
         m_spriteBatcher->beginBatch();
-        for (std::vector<Jon *>::iterator i = jon.getAfterImages().begin(); i != jon.getAfterImages().end(); ++i)
+        for (std::vector<JonAfterImage>::iterator i = jon.getAfterImages().begin(); i != jon.getAfterImages().end(); ++i)
         {
-            Jon* pItem = *i;
-            Jon& item = *pItem;
-            renderPhysicalEntityWithColor(item, MAIN_ASSETS->get(pItem), item.getColor());
+            JonAfterImage& item = *i;
+            m_spriteBatcher->drawSprite(item.x, item.y, item.width, item.height, 0, item.color, MAIN_ASSETS->get(&item));
         }
         m_spriteBatcher->endBatch(*m_vampire->gpuTextureWrapper, *m_textureGpuProgramWrapper);
         
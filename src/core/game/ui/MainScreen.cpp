@@ -120,6 +120,9 @@ void MainScreen::onPause()
 {
     NG_AUDIO_ENGINE->pause();
     
+    // The OS is free to kill us from here on
+    m_saveData->flush();
+    
     if (m_stateMachine.getCurrentState()->getRTTI().derivesFrom(Level::rtti))
     {
         Level* level = (Level*) m_stateMachine.getCurrentState();
@@ -744,6 +744,8 @@ void MainScreenLevelEditor::resetEntities(bool clearLastAddedEntity)
     
     std::sort(m_game->getGrounds().begin(), m_game->getGrounds().end(), sortGrounds);
     
+    m_game->onEntitiesReordered();
+    
     EntityUtils::addAll(m_game->getMidgrounds(), m_gameEntities);
     EntityUtils::addAll(m_game->getGrounds(), m_gameEntities);
     EntityUtils::addAll(m_game->getPits(), m_gameEntities);
@@ -12,6 +12,7 @@
 #include "MainScreenState.h"
 
 #include "RTTI.h"
+#include "UserDemoAction.h"
 
 #include <vector>
 
@@ -26,26 +27,7 @@ class Hole;
 class ForegroundObject;
 class BatPanel;
 class PhysicalEntity;
-
-typedef enum
-{
-    DemoAction_Exit,
-    DemoAction_TriggerJump,
-    DemoAction_TriggerTransform,
-    DemoAction_TriggerRight,
-    DemoAction_TriggerUp,
-    DemoAction_TriggerLeft,
-    DemoAction_TriggerDown
-} DemoAction;
-
-class UserDemoAction
-{
-public:
-    DemoAction m_action;
-    float m_fStateTimeToExecuteAction;
-    
-    UserDemoAction(DemoAction action, float stateTimeToExecuteAction);
-};
+class Replay;
 
 class Level : public MainScreenState
 {
@@ -66,6 +48,8 @@ public:
     
     void launchInDemoMode(std::vector<UserDemoAction> userDemoActions);
     
+    void launchReplay(Replay* replay);
+    
     bool hasCompletedLevel();
     
     Game& getGame();
@@ -77,7 +61,8 @@ public:
     float getStateTime();
     
 protected:
-    const char* m_json;
+    int m_iWorld;
+    int m_iLevel;
     Game* m_game;
     Game* m_sourceGame;
     GameButton* m_backButton;
@@ -97,7 +82,10 @@ protected:
     bool m_isDisplayingResults;
     bool m_createdOwnSourceGame; // Can also be injected by the Level Editor
     std::vector<UserDemoAction> m_userDemoActions;
+    Replay* m_replay;
+    int m_iTick;
     bool m_isDemoMode;
+    bool m_isRecordingReplay;
     bool m_isDebug;
     bool m_isShowingBounds;
     bool m_hasExited;
@@ -129,7 +117,7 @@ protected:
     bool handleInput(MainScreen* ms);
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Level(const char* m_json = nullptr);
+    Level(int world = 0, int level = 0);
     virtual ~Level();
     Level(const Level&);
     Level& operator=(const Level&);
@@ -138,7 +126,15 @@ private:
     bool m_playLevelSelectMusicOnExit;
 	bool m_stopMusicOnExit;
     
+    void initGame(MainScreen* ms);
+    
+    void restartGame(MainScreen* ms);
+    
     void handleCollections(PhysicalEntity& entity, std::vector<CollectibleItem *>& items, float deltaTime);
+    
+    void executeDemoAction(MainScreen* ms, DemoAction action);
+    
+    void saveReplay();
 };
 
 class Chapter1Level1 : public Level
@@ -156,7 +152,7 @@ private:
     static Chapter1Level1* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level1(const char* json);
+    Chapter1Level1();
     Chapter1Level1(const Chapter1Level1&);
     Chapter1Level1& operator=(const Chapter1Level1&);
 };
@@ -176,7 +172,7 @@ private:
     static Chapter1Level2* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level2(const char* json);
+    Chapter1Level2();
     Chapter1Level2(const Chapter1Level2&);
     Chapter1Level2& operator=(const Chapter1Level2&);
 };
@@ -196,7 +192,7 @@ private:
     static Chapter1Level3* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level3(const char* json);
+    Chapter1Level3();
     Chapter1Level3(const Chapter1Level3&);
     Chapter1Level3& operator=(const Chapter1Level3&);
 };
@@ -216,7 +212,7 @@ private:
     static Chapter1Level4* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level4(const char* json);
+    Chapter1Level4();
     Chapter1Level4(const Chapter1Level4&);
     Chapter1Level4& operator=(const Chapter1Level4&);
 };
@@ -236,7 +232,7 @@ private:
     static Chapter1Level5* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level5(const char* json);
+    Chapter1Level5();
     Chapter1Level5(const Chapter1Level5&);
     Chapter1Level5& operator=(const Chapter1Level5&);
 };
@@ -256,7 +252,7 @@ private:
     static Chapter1Level6* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level6(const char* json);
+    Chapter1Level6();
     Chapter1Level6(const Chapter1Level6&);
     Chapter1Level6& operator=(const Chapter1Level6&);
 };
@@ -276,7 +272,7 @@ private:
     static Chapter1Level7* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level7(const char* json);
+    Chapter1Level7();
     Chapter1Level7(const Chapter1Level7&);
     Chapter1Level7& operator=(const Chapter1Level7&);
 };
@@ -296,7 +292,7 @@ private:
     static Chapter1Level8* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level8(const char* json);
+    Chapter1Level8();
     Chapter1Level8(const Chapter1Level8&);
     Chapter1Level8& operator=(const Chapter1Level8&);
 };
@@ -316,7 +312,7 @@ private:
     static Chapter1Level9* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level9(const char* json);
+    Chapter1Level9();
     Chapter1Level9(const Chapter1Level9&);
     Chapter1Level9& operator=(const Chapter1Level9&);
 };
@@ -368,7 +364,7 @@ private:
     virtual void configBatPanel();
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level10(const char* json);
+    Chapter1Level10();
     virtual ~Chapter1Level10();
     Chapter1Level10(const Chapter1Level10&);
     Chapter1Level10& operator=(const Chapter1Level10&);
@@ -389,7 +385,7 @@ private:
     static Chapter1Level11* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level11(const char* json);
+    Chapter1Level11();
     Chapter1Level11(const Chapter1Level11&);
     Chapter1Level11& operator=(const Chapter1Level11&);
 };
@@ -409,7 +405,7 @@ private:
     static Chapter1Level12* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level12(const char* json);
+    Chapter1Level12();
     Chapter1Level12(const Chapter1Level12&);
     Chapter1Level12& operator=(const Chapter1Level12&);
 };
@@ -429,7 +425,7 @@ private:
     static Chapter1Level13* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level13(const char* json);
+    Chapter1Level13();
     Chapter1Level13(const Chapter1Level13&);
     Chapter1Level13& operator=(const Chapter1Level13&);
 };
@@ -449,7 +445,7 @@ private:
     static Chapter1Level14* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level14(const char* json);
+    Chapter1Level14();
     Chapter1Level14(const Chapter1Level14&);
     Chapter1Level14& operator=(const Chapter1Level14&);
 };
@@ -469,7 +465,7 @@ private:
     static Chapter1Level15* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level15(const char* json);
+    Chapter1Level15();
     Chapter1Level15(const Chapter1Level15&);
     Chapter1Level15& operator=(const Chapter1Level15&);
 };
@@ -489,7 +485,7 @@ private:
     static Chapter1Level16* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level16(const char* json);
+    Chapter1Level16();
     Chapter1Level16(const Chapter1Level16&);
     Chapter1Level16& operator=(const Chapter1Level16&);
 };
@@ -509,7 +505,7 @@ private:
     static Chapter1Level17* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level17(const char* json);
+    Chapter1Level17();
     Chapter1Level17(const Chapter1Level17&);
     Chapter1Level17& operator=(const Chapter1Level17&);
 };
@@ -529,7 +525,7 @@ private:
     static Chapter1Level18* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level18(const char* json);
+    Chapter1Level18();
     Chapter1Level18(const Chapter1Level18&);
     Chapter1Level18& operator=(const Chapter1Level18&);
 };
@@ -549,7 +545,7 @@ private:
     static Chapter1Level19* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level19(const char* json);
+    Chapter1Level19();
     Chapter1Level19(const Chapter1Level19&);
     Chapter1Level19& operator=(const Chapter1Level19&);
 };
@@ -569,7 +565,7 @@ private:
     static Chapter1Level20* s_pInstance;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level20(const char* json);
+    Chapter1Level20();
     Chapter1Level20(const Chapter1Level20&);
     Chapter1Level20& operator=(const Chapter1Level20&);
 };
@@ -627,7 +623,7 @@ private:
     virtual void configBatPanel();
     
     // ctor, copy ctor, and assignment should be private in a Singleton
-    Chapter1Level21(const char* json);
+    Chapter1Level21();
     Chapter1Level21(const Chapter1Level21&);
     Chapter1Level21& operator=(const Chapter1Level21&);
 };
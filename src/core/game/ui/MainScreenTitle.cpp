@@ -35,6 +35,7 @@
 #include "JsonFile.h"
 #include "StringUtil.h"
 #include "MainScreenWorldMap.h"
+#include "Replay.h"
 
 /// Title Screen ///
 
@@ -102,6 +103,20 @@ void Title::execute(MainScreen* ms)
         
         if (m_fStateTime > 19)
         {
+#ifdef NG_CHEATS
+            // Play back the last recorded session instead of a scripted demo
+            std::string key = std::string("ng_play_replay");
+            std::string val = ms->m_saveData->findValue(key);
+            int isPlayingReplay = StringUtil::stringToNumber<int>(val);
+            if (isPlayingReplay == 1
+                && TitleToDemo::getInstance()->loadReplay(REPLAY_FILE_PATH))
+            {
+                ms->m_stateMachine.changeState(TitleToDemo::getInstance());
+                
+                return;
+            }
+#endif
+            
             srand (static_cast <unsigned> (time(0)));
             int level = rand() % 8 + 1;
             if (level == 8) { level = 21; }
@@ -27,6 +27,7 @@
 #include "NGAudioEngine.h"
 #include "MainRenderer.h"
 #include "MathUtil.h"
+#include "Replay.h"
 
 /// Title to Demo Transition ///
 
@@ -47,7 +48,14 @@ void TitleToDemo::enter(MainScreen* ms)
     
     m_levelState = LevelUtil::getInstanceForWorldAndLevel(m_iWorldToLoad, m_iLevelToLoad);
     
-    m_levelState->launchInDemoMode(LevelUtil::getUserDemoActionsForWorldAndLevel(m_iWorldToLoad, m_iLevelToLoad));
+    if (m_isReplayLoaded)
+    {
+        m_levelState->launchReplay(m_replay);
+    }
+    else
+    {
+        m_levelState->launchInDemoMode(LevelUtil::getUserDemoActionsForWorldAndLevel(m_iWorldToLoad, m_iLevelToLoad));
+    }
 }
 
 void TitleToDemo::execute(MainScreen* ms)
@@ -130,6 +138,7 @@ void TitleToDemo::exit(MainScreen* ms)
     m_fTransitionStateTime = 0;
     m_iWorldToLoad = 0;
     m_iLevelToLoad = 0;
+    m_isReplayLoaded = false;
     
     m_fWaitTime = 0;
     m_hasEnteredNextScreen = false;
@@ -157,19 +166,39 @@ void TitleToDemo::setLevelToLoad(int levelToLoad)
     m_iLevelToLoad = levelToLoad;
 }
 
+bool TitleToDemo::loadReplay(const char* filePath)
+{
+    m_isReplayLoaded = m_replay->load(filePath);
+    
+    if (m_isReplayLoaded)
+    {
+        m_iWorldToLoad = m_replay->getWorld();
+        m_iLevelToLoad = m_replay->getLevel();
+    }
+    
+    return m_isReplayLoaded;
+}
+
 TitleToDemo::TitleToDemo() : MainScreenState(),
 m_levelState(nullptr),
+m_replay(new Replay()),
 m_fTransitionStateTime(0),
 m_iWorldToLoad(0),
 m_iLevelToLoad(0),
 m_fWaitTime(0),
 m_hasStoppedMusic(false),
 m_hasLoadedNextScreen(false),
-m_hasEnteredNextScreen(false)
+m_hasEnteredNextScreen(false),
+m_isReplayLoaded(false)
 {
     // Empty
 }
 
+TitleToDemo::~TitleToDemo()
+{
+    delete m_replay;
+}
+
 /// Title To World Map Transition ///
 
 TitleToWorldMap * TitleToWorldMap::getInstance()
@@ -16,6 +16,7 @@
 class MainScreen;
 class Level;
 class Game;
+class Replay;
 
 class TitleToDemo : public MainScreenState
 {
@@ -36,8 +37,11 @@ public:
     
     void setLevelToLoad(int levelToLoad);
     
+    bool loadReplay(const char* filePath);
+    
 private:
     Level* m_levelState;
+    Replay* m_replay;
     float m_fTransitionStateTime;
     int m_iWorldToLoad;
     int m_iLevelToLoad;
@@ -45,9 +49,11 @@ private:
     bool m_hasStoppedMusic;
     bool m_hasLoadedNextScreen;
     bool m_hasEnteredNextScreen;
+    bool m_isReplayLoaded;
     
     // ctor, copy ctor, and assignment should be private in a Singleton
     TitleToDemo();
+    ~TitleToDemo();
     TitleToDemo(const TitleToDemo&);
     TitleToDemo& operator=(const TitleToDemo&);
 };
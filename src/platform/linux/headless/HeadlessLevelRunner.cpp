@@ -0,0 +1,350 @@
+//
+//  HeadlessLevelRunner.cpp
+//  nosfuratu
+//
+
+#include "pch.h"
+
+#include "HeadlessLevelRunner.h"
+
+#include "Game.h"
+#include "Jon.h"
+#include "Enemy.h"
+#include "CollectibleItem.h"
+#include "CountHissWithMina.h"
+#include "NGRect.h"
+#include "Vector2D.h"
+#include "GameConstants.h"
+#include "OverlapTester.h"
+
+#include <assert.h>
+
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME 16777619u
+
+static uint32_t hashBytes(uint32_t hash, const void* data, size_t length)
+{
+    const unsigned char* bytes = (const unsigned char*) data;
+    
+    for (size_t i = 0; i < length; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    
+    return hash;
+}
+
+static uint32_t hashFloat(uint32_t hash, float value)
+{
+    return hashBytes(hash, &value, sizeof(float));
+}
+
+static uint32_t hashInt(uint32_t hash, int value)
+{
+    return hashBytes(hash, &value, sizeof(int));
+}
+
+HeadlessLevelRunner::HeadlessLevelRunner() :
+m_sourceGame(new Game()),
+m_game(new Game()),
+m_camBounds(new NGRect(0, 0, CAM_WIDTH, CAM_HEIGHT)),
+m_iUserDemoActionIndex(0),
+m_fDeathStateTime(0),
+m_iJonAbilityFlag(FLAG_ABILITY_ALL),
+m_iNumTicks(0),
+m_iNumDeaths(0),
+m_hasCompletedLevel(false)
+{
+    // Empty
+}
+
+HeadlessLevelRunner::~HeadlessLevelRunner()
+{
+    delete m_game;
+    delete m_sourceGame;
+    delete m_camBounds;
+}
+
+bool HeadlessLevelRunner::loadJson(const char* json)
+{
+    m_sourceGame->load(json);
+    
+    return m_sourceGame->isLoaded();
+}
+
+bool HeadlessLevelRunner::loadCompiled(const unsigned char* data, size_t length)
+{
+    return m_sourceGame->loadCompiled(data, length);
+}
+
+void HeadlessLevelRunner::setUserDemoActions(std::vector<UserDemoAction>& userDemoActions)
+{
+    m_userDemoActions = userDemoActions;
+    m_iUserDemoActionIndex = 0;
+}
+
+void HeadlessLevelRunner::setJonAbilityFlag(int jonAbilityFlag)
+{
+    m_iJonAbilityFlag = jonAbilityFlag;
+}
+
+void HeadlessLevelRunner::begin()
+{
+    assert(m_sourceGame->isLoaded());
+    
+    m_game->copy(m_sourceGame);
+    m_game->takeSnapshot();
+    
+    initGame();
+    
+    m_iUserDemoActionIndex = 0;
+    m_iNumTicks = 0;
+    m_iNumDeaths = 0;
+    m_hasCompletedLevel = false;
+}
+
+void HeadlessLevelRunner::tick(float deltaTime)
+{
+    // Mirrors the logic half of Level::update, minus the opening sequence, panels and audio
+    
+    applyUserDemoActions(false);
+    
+    m_iNumTicks++;
+    
+    Jon& jon = m_game->getJon();
+    
+    if (jon.isDead())
+    {
+        m_fDeathStateTime += deltaTime * 2;
+        
+        if (m_fDeathStateTime > 1.6f)
+        {
+            m_game->restoreSnapshot();
+            
+            initGame();
+            
+            m_iNumDeaths++;
+        }
+        
+        return;
+    }
+    
+    m_game->updateScore();
+    
+    if (!m_hasCompletedLevel)
+    {
+        m_game->update(deltaTime);
+    }
+    
+    if ((jon.isTransformingIntoVampire() || jon.isRevertingToRabbit())
+        && !jon.isReleasingShockwave())
+    {
+        deltaTime /= 8;
+    }
+    
+    m_game->updateAndClean(deltaTime);
+    
+    handleCollections(jon, m_game->getNearbyCollectibleItems(&jon));
+    
+    m_game->updateScore();
+    
+    applyUserDemoActions(true);
+    
+    updateCamera();
+    
+    if (!m_hasCompletedLevel
+        && jon.getMainBounds().getLeft() > m_game->getFarRight())
+    {
+        jon.setUserActionPrevented(true);
+        
+        m_game->updateScoreFromTime();
+        m_game->updateScore();
+        
+        m_hasCompletedLevel = true;
+    }
+}
+
+uint32_t HeadlessLevelRunner::calcChecksum()
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    
+    Jon& jon = m_game->getJon();
+    hash = hashFloat(hash, jon.getPosition().getX());
+    hash = hashFloat(hash, jon.getPosition().getY());
+    hash = hashFloat(hash, jon.getVelocity().getX());
+    hash = hashFloat(hash, jon.getVelocity().getY());
+    hash = hashInt(hash, jon.getPhysicalState());
+    hash = hashInt(hash, jon.isDead() ? 1 : 0);
+    
+    hash = hashFloat(hash, m_game->getStateTime());
+    hash = hashInt(hash, m_game->getScore());
+    hash = hashInt(hash, m_game->getNumCarrotsCollected());
+    hash = hashInt(hash, m_game->getNumGoldenCarrotsCollected());
+    hash = hashInt(hash, m_game->getNumVialsCollected());
+    hash = hashInt(hash, m_game->calcSum());
+    
+    std::vector<Enemy *>& enemies = m_game->getEnemies();
+    for (std::vector<Enemy *>::iterator i = enemies.begin(); i != enemies.end(); ++i)
+    {
+        hash = hashFloat(hash, (*i)->getPosition().getX());
+        hash = hashFloat(hash, (*i)->getPosition().getY());
+        hash = hashInt(hash, (*i)->isDead() ? 1 : 0);
+    }
+    
+    std::vector<CollectibleItem *>& items = m_game->getCollectibleItems();
+    for (std::vector<CollectibleItem *>::iterator i = items.begin(); i != items.end(); ++i)
+    {
+        hash = hashInt(hash, (*i)->isCollected() ? 1 : 0);
+    }
+    
+    return hash;
+}
+
+Game& HeadlessLevelRunner::getGame()
+{
+    return *m_game;
+}
+
+Game& HeadlessLevelRunner::getSourceGame()
+{
+    return *m_sourceGame;
+}
+
+int HeadlessLevelRunner::getNumTicks()
+{
+    return m_iNumTicks;
+}
+
+int HeadlessLevelRunner::getNumDeaths()
+{
+    return m_iNumDeaths;
+}
+
+bool HeadlessLevelRunner::hasCompletedLevel()
+{
+    return m_hasCompletedLevel;
+}
+
+#pragma mark private
+
+void HeadlessLevelRunner::initGame()
+{
+    m_game->setCameraBounds(m_camBounds);
+    
+    Jon& jon = m_game->getJon();
+    jon.setAbilityFlag(m_iJonAbilityFlag);
+    
+    // Skip the opening panning sequence and drop straight into play
+    CountHissWithMina& countHissWithMina = m_game->getCountHissWithMina();
+    countHissWithMina.beginMovement();
+    countHissWithMina.getPosition().setX(m_game->getFarRight() + CAM_WIDTH * 2);
+    
+    jon.beginWarmingUp();
+    jon.setAllowedToMove(true);
+    
+    m_fDeathStateTime = 0;
+    
+    updateCamera();
+}
+
+void HeadlessLevelRunner::applyUserDemoActions(bool isAfterUpdate)
+{
+    // Same timing as Level, ticks count the steps already taken and held transforms fire after the update
+    Jon& jon = m_game->getJon();
+    
+    while (m_iUserDemoActionIndex < m_userDemoActions.size()
+           && m_userDemoActions[m_iUserDemoActionIndex].m_iTickToExecuteAction <= m_iNumTicks)
+    {
+        DemoAction action = m_userDemoActions[m_iUserDemoActionIndex].m_action;
+        
+        if (isAfterUpdate
+            && action != DemoAction_TriggerHeldTransform)
+        {
+            break;
+        }
+        
+        switch (action)
+        {
+            case DemoAction_TriggerJump:
+                jon.triggerJump();
+                break;
+            case DemoAction_TriggerTransform:
+            case DemoAction_TriggerHeldTransform:
+                jon.triggerTransform();
+                break;
+            case DemoAction_TriggerRight:
+                jon.triggerRightAction();
+                break;
+            case DemoAction_TriggerUp:
+                jon.triggerUpAction();
+                break;
+            case DemoAction_TriggerLeft:
+                jon.triggerLeftAction();
+                break;
+            case DemoAction_TriggerDown:
+                jon.triggerDownAction();
+                break;
+            case DemoAction_TriggerCancelTransform:
+                jon.triggerCancelTransform();
+                break;
+            default:
+                break;
+        }
+        
+        m_iUserDemoActionIndex++;
+    }
+}
+
+void HeadlessLevelRunner::updateCamera()
+{
+    // A snapping version of MainRenderer::updateCameraToFollowJon, entities only care which region is on screen
+    Jon& jon = m_game->getJon();
+    
+    float camX = jon.getPosition().getX() - CAM_WIDTH / 6;
+    float camY = jon.getMainBounds().getBottom() - 0.5625f;
+    
+    if (camY < 0)
+    {
+        camY = 0;
+    }
+    else if (camY > GAME_HEIGHT - CAM_HEIGHT)
+    {
+        camY = GAME_HEIGHT - CAM_HEIGHT;
+    }
+    
+    m_camBounds->getLowerLeft().set(camX, camY);
+}
+
+void HeadlessLevelRunner::handleCollections(PhysicalEntity& entity, std::vector<CollectibleItem *>& items)
+{
+    for (std::vector<CollectibleItem *>::iterator i = items.begin(); i != items.end(); ++i)
+    {
+        if ((*i)->isCollected())
+        {
+            continue;
+        }
+        
+        if (OverlapTester::doNGRectsOverlap(entity.getMainBounds(), (*i)->getMainBounds()))
+        {
+            (*i)->collect();
+            
+            if ((*i)->getType() == CollectibleItemType_GoldenCarrot)
+            {
+                m_game->setNumGoldenCarrotsCollected(m_game->getNumGoldenCarrotsCollected() + 1);
+            }
+            else if ((*i)->getType() == CollectibleItemType_BigCarrot)
+            {
+                m_game->setNumCarrotsCollected(m_game->getNumCarrotsCollected() + 10);
+            }
+            else if ((*i)->getType() == CollectibleItemType_Vial)
+            {
+                m_game->setNumVialsCollected(m_game->getNumVialsCollected() + 1);
+            }
+            else
+            {
+                m_game->setNumCarrotsCollected(m_game->getNumCarrotsCollected() + 1);
+            }
+        }
+    }
+}
@@ -0,0 +1,71 @@
+//
+//  HeadlessLevelRunner.h
+//  nosfuratu
+//
+
+#ifndef __nosfuratu__HeadlessLevelRunner__
+#define __nosfuratu__HeadlessLevelRunner__
+
+#include "UserDemoAction.h"
+
+#include <vector>
+#include <stdint.h>
+
+class Game;
+class NGRect;
+class PhysicalEntity;
+class CollectibleItem;
+
+class HeadlessLevelRunner
+{
+public:
+    HeadlessLevelRunner();
+    
+    ~HeadlessLevelRunner();
+    
+    bool loadJson(const char* json);
+    
+    bool loadCompiled(const unsigned char* data, size_t length);
+    
+    void setUserDemoActions(std::vector<UserDemoAction>& userDemoActions);
+    
+    void setJonAbilityFlag(int jonAbilityFlag);
+    
+    void begin();
+    
+    void tick(float deltaTime);
+    
+    uint32_t calcChecksum();
+    
+    Game& getGame();
+    
+    Game& getSourceGame();
+    
+    int getNumTicks();
+    
+    int getNumDeaths();
+    
+    bool hasCompletedLevel();
+
+private:
+    Game* m_sourceGame;
+    Game* m_game;
+    NGRect* m_camBounds;
+    std::vector<UserDemoAction> m_userDemoActions;
+    size_t m_iUserDemoActionIndex;
+    float m_fDeathStateTime;
+    int m_iJonAbilityFlag;
+    int m_iNumTicks;
+    int m_iNumDeaths;
+    bool m_hasCompletedLevel;
+    
+    void initGame();
+    
+    void applyUserDemoActions(bool isAfterUpdate);
+    
+    void updateCamera();
+    
+    void handleCollections(PhysicalEntity& entity, std::vector<CollectibleItem *>& items);
+};
+
+#endif /* defined(__nosfuratu__HeadlessLevelRunner__) */
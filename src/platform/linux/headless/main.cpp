@@ -0,0 +1,367 @@
+//
+//  main.cpp
+//  nosfuratu
+//
+
+#include "pch.h"
+
+#include "HeadlessLevelRunner.h"
+
+#include "Game.h"
+#include "NGAudioEngine.h"
+#include "CompiledLevel.h"
+#include "Replay.h"
+#include "GameConstants.h"
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdio.h>
+
+#define FRAME_RATE 0.01666666666667f // 60 frames per second, must match MainScreen
+#define DEFAULT_NUM_TICKS 3600
+
+static void printUsage()
+{
+    fprintf(stderr, "usage: nosfuratu_headless <level.json|level.nglevel> [--ticks N] [--script file | --replay file.ngreplay] [--record file.ngreplay] [--ability flag] [--checksums] [--bench-load N]\n");
+    fprintf(stderr, "  script lines are \"<tick> <jump|transform|right|up|left|down|cancel|hold>\", # starts a comment\n");
+}
+
+static bool readFile(const char* path, std::string& contents)
+{
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+    
+    std::stringstream ss;
+    ss << file.rdbuf();
+    contents = ss.str();
+    
+    return true;
+}
+
+static bool parseScript(const std::string& text, std::vector<UserDemoAction>& userDemoActions)
+{
+    std::istringstream lines(text);
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        line = line.substr(0, line.find('#'));
+        
+        std::istringstream tokens(line);
+        int tick;
+        std::string name;
+        if (!(tokens >> tick))
+        {
+            continue;
+        }
+        
+        if (!(tokens >> name))
+        {
+            return false;
+        }
+        
+        DemoAction action;        
+        if (name == "jump")
+        {
+            action = DemoAction_TriggerJump;
+        }
+        else if (name == "transform")
+        {
+            action = DemoAction_TriggerTransform;
+        }
+        else if (name == "right")
+        {
+            action = DemoAction_TriggerRight;
+        }
+        else if (name == "up")
+        {
+            action = DemoAction_TriggerUp;
+        }
+        else if (name == "left")
+        {
+            action = DemoAction_TriggerLeft;
+        }
+        else if (name == "down")
+        {
+            action = DemoAction_TriggerDown;
+        }
+        else if (name == "cancel")
+        {
+            action = DemoAction_TriggerCancelTransform;
+        }
+        else if (name == "hold")
+        {
+            action = DemoAction_TriggerHeldTransform;
+        }
+        else
+        {
+            return false;
+        }
+        
+        if (userDemoActions.size() > 0
+            && userDemoActions.back().m_iTickToExecuteAction > tick)
+        {
+            return false;
+        }
+        
+        userDemoActions.push_back(UserDemoAction(action, 0, tick));
+    }
+    
+    return true;
+}
+
+static bool isCompiledLevel(const std::string& data)
+{
+    if (data.length() < sizeof(CompiledLevelHeader))
+    {
+        return false;
+    }
+    
+    const CompiledLevelHeader* header = (const CompiledLevelHeader*) data.data();
+    
+    return header->magic == COMPILED_LEVEL_MAGIC;
+}
+
+static bool benchLoad(const std::string& levelData, int numLoads)
+{
+    // Loads the same level over and over, the way entering it from the level select would
+    bool isCompiled = isCompiledLevel(levelData);
+    
+    Game game;
+    
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    
+    for (int i = 0; i < numLoads; ++i)
+    {
+        if (isCompiled)
+        {
+            if (!game.loadCompiled((const unsigned char*) levelData.data(), levelData.length()))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            game.load(levelData.c_str());
+            
+            if (!game.isLoaded())
+            {
+                return false;
+            }
+        }
+    }
+    
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    printf("level: world %d level %d\n", game.getWorld(), game.getLevel());
+    printf("loads: %d in %.3f s (%.1f us/load, %d bytes)\n", numLoads, seconds, numLoads > 0 ? seconds * 1000000 / numLoads : 0, (int) levelData.length());
+    
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        printUsage();
+        
+        return 1;
+    }
+    
+    const char* levelPath = argv[1];
+    const char* scriptPath = nullptr;
+    const char* replayPath = nullptr;
+    const char* recordPath = nullptr;
+    int numTicks = -1;
+    int jonAbilityFlag = -1;
+    int numBenchLoads = 0;
+    bool printChecksums = false;
+    
+    for (int i = 2; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--ticks" && i + 1 < argc)
+        {
+            numTicks = atoi(argv[++i]);
+        }
+        else if (arg == "--script" && i + 1 < argc)
+        {
+            scriptPath = argv[++i];
+        }
+        else if (arg == "--replay" && i + 1 < argc)
+        {
+            replayPath = argv[++i];
+        }
+        else if (arg == "--record" && i + 1 < argc)
+        {
+            recordPath = argv[++i];
+        }
+        else if (arg == "--ability" && i + 1 < argc)
+        {
+            jonAbilityFlag = atoi(argv[++i]);
+        }
+        else if (arg == "--checksums")
+        {
+            printChecksums = true;
+        }
+        else if (arg == "--bench-load" && i + 1 < argc)
+        {
+            numBenchLoads = atoi(argv[++i]);
+        }
+        else
+        {
+            printUsage();
+            
+            return 1;
+        }
+    }
+    
+    NG_AUDIO_ENGINE->setSoundDisabled(true);
+    NG_AUDIO_ENGINE->setMusicDisabled(true);
+    
+    std::string levelData;
+    if (!readFile(levelPath, levelData))
+    {
+        fprintf(stderr, "could not read %s\n", levelPath);
+        
+        return 1;
+    }
+    
+    if (numBenchLoads > 0)
+    {
+        if (!benchLoad(levelData, numBenchLoads))
+        {
+            fprintf(stderr, "could not load %s\n", levelPath);
+            
+            return 1;
+        }
+        
+        return 0;
+    }
+    
+    HeadlessLevelRunner runner;
+    
+    bool isLoaded = isCompiledLevel(levelData) ? runner.loadCompiled((const unsigned char*) levelData.data(), levelData.length()) : runner.loadJson(levelData.c_str());
+    if (!isLoaded)
+    {
+        fprintf(stderr, "could not load %s\n", levelPath);
+        
+        return 1;
+    }
+    
+    Replay replay;
+    
+    if (scriptPath)
+    {
+        std::string scriptText;
+        if (!readFile(scriptPath, scriptText)
+            || !parseScript(scriptText, replay.getUserDemoActions()))
+        {
+            fprintf(stderr, "could not parse script %s\n", scriptPath);
+            
+            return 1;
+        }
+    }
+    else if (replayPath)
+    {
+        if (!replay.load(replayPath))
+        {
+            fprintf(stderr, "could not load replay %s\n", replayPath);
+            
+            return 1;
+        }
+        
+        Game& game = runner.getSourceGame();
+        if (replay.getWorld() != game.getWorld()
+            || replay.getLevel() != game.getLevel())
+        {
+            fprintf(stderr, "warning: replay was recorded on world %d level %d\n", replay.getWorld(), replay.getLevel());
+        }
+        
+        if (jonAbilityFlag < 0)
+        {
+            jonAbilityFlag = replay.getJonAbilityFlag();
+        }
+        
+        if (numTicks < 0)
+        {
+            numTicks = replay.getNumTicks();
+        }
+    }
+    
+    if (numTicks < 0)
+    {
+        numTicks = DEFAULT_NUM_TICKS;
+    }
+    
+    runner.setUserDemoActions(replay.getUserDemoActions());
+    
+    if (jonAbilityFlag >= 0)
+    {
+        runner.setJonAbilityFlag(jonAbilityFlag);
+    }
+    
+    runner.begin();
+    
+    std::vector<uint32_t> checksums;
+    checksums.reserve(numTicks);
+    
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    
+    for (int i = 0; i < numTicks; ++i)
+    {
+        runner.tick(FRAME_RATE);
+        
+        checksums.push_back(runner.calcChecksum());
+    }
+    
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    if (printChecksums)
+    {
+        for (size_t i = 0; i < checksums.size(); ++i)
+        {
+            printf("%d %08x\n", (int) i + 1, checksums[i]);
+        }
+    }
+    
+    Game& game = runner.getGame();
+    
+    printf("level: world %d level %d\n", game.getWorld(), game.getLevel());
+    printf("ticks: %d in %.3f s (%.0f ticks/s)\n", runner.getNumTicks(), seconds, seconds > 0 ? runner.getNumTicks() / seconds : 0);
+    printf("deaths: %d, completed: %s, score: %d\n", runner.getNumDeaths(), runner.hasCompletedLevel() ? "yes" : "no", game.getScore());
+    printf("checksum: %08x\n", checksums.size() > 0 ? checksums.back() : 0);
+    
+    if (recordPath)
+    {
+        // Turns a script into a replay the game can play back from the title screen
+        Replay record;
+        record.reset(game.getWorld(), game.getLevel(), jonAbilityFlag >= 0 ? jonAbilityFlag : FLAG_ABILITY_ALL, 0);
+        
+        std::vector<UserDemoAction>& userDemoActions = replay.getUserDemoActions();
+        for (std::vector<UserDemoAction>::iterator i = userDemoActions.begin(); i != userDemoActions.end(); ++i)
+        {
+            if ((*i).m_action != DemoAction_Exit
+                && (*i).m_iTickToExecuteAction <= numTicks)
+            {
+                record.record((*i).m_action, (*i).m_iTickToExecuteAction);
+            }
+        }
+        
+        record.finish(numTicks);
+        
+        if (!record.save(recordPath))
+        {
+            fprintf(stderr, "could not write replay %s\n", recordPath);
+            
+            return 1;
+        }
+    }
+    
+    return 0;
+}
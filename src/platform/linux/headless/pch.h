@@ -0,0 +1,14 @@
+//
+//  pch.h
+//  nosfuratu
+//
+
+#ifndef __noctisgames__pch__
+#define __noctisgames__pch__
+
+// Headless builds only compile game logic, so there is no graphics API to pull in
+
+#include <string.h>
+#include <stdlib.h>
+
+#endif /* defined(__noctisgames__pch__) */
@@ -0,0 +1,154 @@
+//
+//  JsonFileCrashTest.cpp
+//  noctisgames-framework
+//
+
+#include "pch.h"
+
+#include "JsonFile.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#define NUM_KILLS 200
+#define NUM_KEYS 40
+#define VALUE_PADDING 512
+
+// Kills a process that saves as fast as it can at a random point, usually mid write,
+// then checks the file on disk is one whole generation, either the old one or a newer one
+static std::string makeValue(int generation)
+{
+    char buffer[16];
+    snprintf(buffer, sizeof(buffer), "%d:", generation);
+    
+    return std::string(buffer) + std::string(VALUE_PADDING, 'x');
+}
+
+static std::string makeKey(int i)
+{
+    char buffer[16];
+    snprintf(buffer, sizeof(buffer), "key%d", i);
+    
+    return std::string(buffer);
+}
+
+static void saveGeneration(JsonFile& file, int generation)
+{
+    std::string value = makeValue(generation);
+    for (int i = 0; i < NUM_KEYS; ++i)
+    {
+        file.setValue(makeKey(i), value);
+    }
+    
+    file.save();
+}
+
+// -1 if the keys are missing or come from more than one generation
+static int readGeneration(const std::string& path)
+{
+    JsonFile file(path.c_str());
+    file.load();
+    
+    std::string first = file.findValue(makeKey(0));
+    int generation = atoi(first.c_str());
+    
+    if (first != makeValue(generation))
+    {
+        return -1;
+    }
+    
+    for (int i = 1; i < NUM_KEYS; ++i)
+    {
+        if (file.findValue(makeKey(i)) != first)
+        {
+            return -1;
+        }
+    }
+    
+    return generation;
+}
+
+int main(int argc, char* argv[])
+{
+    char dir[] = "/tmp/nosfuratu_json_file_XXXXXX";
+    if (!mkdtemp(dir))
+    {
+        perror("mkdtemp");
+        
+        return 1;
+    }
+    
+    std::string path = std::string(dir) + "/save.json";
+    
+    {
+        JsonFile file(path.c_str());
+        saveGeneration(file, 0);
+    }
+    
+    srand((unsigned int) getpid());
+    
+    int generation = 0;
+    int numGenerationsAdvanced = 0;
+    int numTorn = 0;
+    
+    for (int i = 0; i < NUM_KILLS; ++i)
+    {
+        pid_t pid = fork();
+        if (pid < 0)
+        {
+            perror("fork");
+            
+            return 1;
+        }
+        
+        if (pid == 0)
+        {
+            JsonFile file(path.c_str());
+            
+            for (int nextGeneration = generation + 1; ; ++nextGeneration)
+            {
+                saveGeneration(file, nextGeneration);
+            }
+        }
+        
+        usleep(1000 + rand() % 20000);
+        
+        kill(pid, SIGKILL);
+        waitpid(pid, nullptr, 0);
+        
+        int onDisk = readGeneration(path);
+        if (onDisk < generation)
+        {
+            fprintf(stderr, "kill %d: expected generation %d or later, found %s\n", i, generation, onDisk < 0 ? "a torn file" : "an older one");
+            
+            numTorn++;
+            
+            continue;
+        }
+        
+        if (onDisk > generation)
+        {
+            numGenerationsAdvanced++;
+        }
+        
+        generation = onDisk;
+    }
+    
+    printf("json file crash test: %d kills, %d landed after a newer save, %d torn\n", NUM_KILLS, numGenerationsAdvanced, numTorn);
+    
+    std::string command = std::string("rm -rf ") + dir;
+    system(command.c_str());
+    
+    if (numGenerationsAdvanced == 0)
+    {
+        fprintf(stderr, "no save finished before any kill, nothing was tested\n");
+        
+        return 1;
+    }
+    
+    return numTorn == 0 ? 0 : 1;
+}
@@ -0,0 +1,290 @@
+package compilelevels;
+
+import java.io.BufferedWriter;
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.FileWriter;
+import java.io.FilenameFilter;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.Comparator;
+import java.util.List;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+import javax.swing.JOptionPane;
+
+/**
+ * Compiles the json levels into the fixed record format read by Game::loadCompiled
+ */
+public final class Main
+{
+    private static final Pattern EXTRACT_CHAPTER_AND_LEVEL_REGEX = Pattern.compile(".*?_c([0-9]++)_l([0-9]++).json");
+    private static final Pattern ENTRY_REGEX = Pattern.compile("\\{([^}]*)\\}");
+
+    // Must match CompiledLevel.h
+    private static final int COMPILED_LEVEL_MAGIC = 0x564C474E; // NGLV
+    private static final int COMPILED_LEVEL_VERSION = 1;
+    private static final String[] SECTION_KEYS =
+    {
+        "midgrounds",
+        "grounds",
+        "pits",
+        "exitGrounds",
+        "holes",
+        "foregroundObjects",
+        "midBossForegroundObjects",
+        "endBossForegroundObjects",
+        "countHissWithMinas",
+        "endBossSnakes",
+        "enemies",
+        "collectibles",
+        "jons",
+        "extraForegroundObjects",
+        "foregroundCoverObjects",
+        "markers"
+    };
+
+    private static boolean OPERATING_FROM_COMMAND_LINE;
+
+    /**
+     * @param args the command line arguments
+     */
+    public static void main(String args[])
+    {
+        try
+        {
+            OPERATING_FROM_COMMAND_LINE = args != null && args.length > 0;
+            String pathToRepository;
+            if (OPERATING_FROM_COMMAND_LINE)
+            {
+                pathToRepository = args[0];
+            } else
+            {
+                pathToRepository = JOptionPane.showInputDialog("Enter path to the \"nosfuratu-levels\" repository:");
+            }
+
+            File folder = new File(pathToRepository);
+            File[] listOfFilesArray = folder.listFiles(new FilenameFilter()
+            {
+                @Override
+                public boolean accept(File dir, String name)
+                {
+                    return name.endsWith(".json");
+                }
+            });
+
+            List<File> listOfFiles = Arrays.asList(listOfFilesArray);
+
+            Collections.sort(listOfFiles, new Comparator<File>()
+            {
+                @Override
+                public int compare(File o1, File o2)
+                {
+                    String o1level = findValue(o1.getName(), EXTRACT_CHAPTER_AND_LEVEL_REGEX, 2);
+                    String o2level = findValue(o2.getName(), EXTRACT_CHAPTER_AND_LEVEL_REGEX, 2);
+
+                    Integer o1levelInt = Integer.parseInt(o1level);
+                    Integer o2levelInt = Integer.parseInt(o2level);
+
+                    return o1levelInt.compareTo(o2levelInt);
+                }
+            });
+
+            StringBuilder sb = new StringBuilder();
+
+            for (File file : listOfFiles)
+            {
+                String chapter = findValue(file.getName(), EXTRACT_CHAPTER_AND_LEVEL_REGEX, 1);
+                String level = findValue(file.getName(), EXTRACT_CHAPTER_AND_LEVEL_REGEX, 2);
+
+                String json = new String(Files.readAllBytes(file.toPath()), StandardCharsets.UTF_8);
+
+                byte[] compiledLevel = compileLevel(json);
+
+                String compiledLevelFileName = file.getName().replace(".json", ".nglevel");
+                writeBytesToFile(new File(folder, compiledLevelFileName), compiledLevel);
+
+                appendEmbeddedArray(sb, chapter, level, compiledLevel);
+            }
+
+            writeCodeToFile(folder, sb.toString(), "compiled_levels");
+        } catch (IOException e)
+        {
+            logException(e);
+        }
+    }
+
+    private static byte[] compileLevel(String json)
+    {
+        List<List<int[]>> sections = new ArrayList<>();
+        int numRecords = 0;
+        for (String key : SECTION_KEYS)
+        {
+            List<int[]> records = parseSection(json, key);
+            sections.add(records);
+            numRecords += records.size();
+        }
+
+        ByteBuffer bb = ByteBuffer.allocate(4 * (4 + SECTION_KEYS.length) + 12 * numRecords);
+        bb.order(ByteOrder.LITTLE_ENDIAN);
+
+        bb.putInt(COMPILED_LEVEL_MAGIC);
+        bb.putInt(COMPILED_LEVEL_VERSION);
+        bb.putInt(parseInt(json, "world", 1));
+        bb.putInt(parseInt(json, "level", 1));
+
+        for (List<int[]> records : sections)
+        {
+            bb.putInt(records.size());
+        }
+
+        for (List<int[]> records : sections)
+        {
+            for (int[] record : records)
+            {
+                bb.putInt(record[0]);
+                bb.putInt(record[1]);
+                bb.putInt(record[2]);
+            }
+        }
+
+        return bb.array();
+    }
+
+    private static List<int[]> parseSection(String json, String key)
+    {
+        List<int[]> records = new ArrayList<>();
+
+        String sectionPrefix = "\"" + key + "\":[";
+        int start = json.indexOf(sectionPrefix);
+        if (start < 0)
+        {
+            return records;
+        }
+
+        start += sectionPrefix.length();
+        int end = json.indexOf(']', start);
+
+        Matcher matcher = ENTRY_REGEX.matcher(json.substring(start, end));
+        while (matcher.find())
+        {
+            String entry = matcher.group(1);
+
+            int[] record = new int[3];
+            record[0] = parseInt(entry, "gridX", 0);
+            record[1] = parseInt(entry, "gridY", 0);
+            record[2] = parseInt(entry, "type", 0);
+
+            records.add(record);
+        }
+
+        return records;
+    }
+
+    private static int parseInt(String text, String key, int defaultValue)
+    {
+        Pattern pattern = Pattern.compile("\"" + key + "\":(-?[0-9]++)");
+        String value = findValue(text, pattern, 1);
+
+        return value.length() > 0 ? Integer.parseInt(value) : defaultValue;
+    }
+
+    private static void appendEmbeddedArray(StringBuilder sb, String chapter, String level, byte[] compiledLevel)
+    {
+        sb.append(String.format("static const unsigned char COMPILED_CHAPTER_%1$s_LEVEL_%2$s[%3$d] =\n", chapter, level, compiledLevel.length));
+        sb.append("{");
+
+        for (int i = 0; i < compiledLevel.length; ++i)
+        {
+            if (i % 16 == 0)
+            {
+                sb.append("\n    ");
+            }
+
+            sb.append(String.format("0x%02x", compiledLevel[i] & 0xff));
+
+            if (i < compiledLevel.length - 1)
+            {
+                sb.append(", ");
+            }
+        }
+
+        sb.append("\n};\n\n");
+    }
+
+    private static void writeBytesToFile(File file, byte[] bytes) throws IOException
+    {
+        FileOutputStream fos = new FileOutputStream(file);
+        try
+        {
+            fos.write(bytes);
+        } finally
+        {
+            fos.close();
+        }
+    }
+
+    private static boolean writeCodeToFile(File repositoryFolder, String cPlusPlusCode, String prefix) throws IOException
+    {
+        File file = new File(repositoryFolder, prefix + "_code_to_paste_into_MainScreenLevels.cpp.txt");
+
+        boolean isWriteSuccessful = false;
+        BufferedWriter writer = null;
+        try
+        {
+            writer = new BufferedWriter(new FileWriter(file));
+            writer.write(cPlusPlusCode);
+
+            isWriteSuccessful = true;
+        } catch (IOException e)
+        {
+            logException(e);
+        } finally
+        {
+            try
+            {
+                if (writer != null)
+                {
+                    writer.close();
+                }
+            } catch (IOException e)
+            {
+                logException(e);
+            }
+        }
+
+        return isWriteSuccessful;
+    }
+
+    private static String findValue(String text, Pattern pattern, int groupIndex)
+    {
+        Matcher matcher = pattern.matcher(text);
+        String value;
+        if (matcher.find())
+        {
+            if (matcher.groupCount() > 0)
+            {
+                value = matcher.group(groupIndex);
+                return value.length() > 0 ? value : "";
+            }
+        }
+
+        return "";
+    }
+
+    private static void logException(Exception e)
+    {
+        System.err.println(e.toString());
+
+        if (!OPERATING_FROM_COMMAND_LINE)
+        {
+            JOptionPane.showMessageDialog(null, e.toString());
+        }
+    }
+}